@@ -15,6 +15,34 @@ constexpr auto punctuation = "!\"#$%&'()*+,-./:;<=>?@[\\]^_`{|}~";
 constexpr auto printable = "0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ \t\n\r\v\f!\"#$%&'()*+,-./:;<=>?@[\\]^_`{|}~";
 
 
+/**
+* Set of chars for the findAnyOf, containsOnly, strip and splitAnyOf families
+* Built once (also at compile time) and reused, the string overloads build one per call.
+* The 32 byte bitset is directly the lookup table of the simd kernels.
+*   constexpr CharSet separators(",;");
+*   splitAnyOf("a,b;c", separators)                     => ["a", "b", "c"]
+*   strip("  abc\n", CharSets::whitespace)              => "abc"
+*   containsOnly("1f0a", CharSets::hexDigits)           => true
+*   CharSet().iAdd("ab").contains('B')                  => true
+*   CharSet().addRange('a', 'f').contains('g')          => false
+*   (~CharSets::digits).contains('1')                   => false
+*   (CharSets::digits | CharSets::punctuation)          => digits and punctuation
+*/
+class CharSet;
+
+namespace CharSets {
+constexpr CharSet asciiLowerCase{ STRINGUTILS_NAMESPACE::asciiLowerCase };
+constexpr CharSet asciiUpperCase{ STRINGUTILS_NAMESPACE::asciiUpperCase };
+constexpr CharSet asciiLetters{ STRINGUTILS_NAMESPACE::asciiLetters };
+constexpr CharSet whitespace{ STRINGUTILS_NAMESPACE::whitespace };
+constexpr CharSet digits{ STRINGUTILS_NAMESPACE::digits };
+constexpr CharSet hexDigits{ STRINGUTILS_NAMESPACE::hexDigits };
+constexpr CharSet octDigits{ STRINGUTILS_NAMESPACE::octDigits };
+constexpr CharSet punctuation{ STRINGUTILS_NAMESPACE::punctuation };
+constexpr CharSet printable{ STRINGUTILS_NAMESPACE::printable };
+} // namespace CharSets
+
+
 /**
 * Joins the strings passed in as parameters into a single string separated by the delimiter.
 * If you don't want a delimiter prefer StringUtils::concat over join with an empty separator.
@@ -132,6 +160,52 @@ template<typename... Args>
 [[nodiscard]] constexpr bool iEquals(const char c1, const char c2) noexcept;
 
 
+/**
+* Three way compare, returns a value < 0, 0 or > 0 if str1 is ordered before, equal to or after str2
+* iCompare compares the lower case strings, chars are ordered as unsigned
+*    compare("abc", "abd")     => < 0
+*    compare("abc", "abc")     => 0
+*    compare("b", "abc")       => > 0
+*    compare("Abc", "abc")     => < 0
+*    iCompare("Abc", "abc")    => 0
+*    iCompare("ABD", "abc")    => > 0
+*    iCompare("ab", "ABC")     => < 0
+*    iCompare("[", "a")        => < 0     ('[' < 'a', but '[' > 'A')
+*/
+[[nodiscard]] constexpr int compare(const std::string_view str1, const std::string_view str2) noexcept;
+
+[[nodiscard]] constexpr int iCompare(const std::string_view str1, const std::string_view str2) noexcept;
+
+
+/**
+* Case insensitive comparators in the order of iCompare, transparent so maps and sets can be searched with any string type
+*    std::map<std::string, int, ILess> headers;
+*    headers.find("content-type")                        => also finds "Content-Type"
+*    std::sort(keys.begin(), keys.end(), IGreater());
+*/
+struct ILess;
+
+struct IGreater;
+
+
+/**
+* Hash and equality functors for unordered containers, IHash and IEqual ignore case like iEquals
+* IHash lower cases the chars while hashing, no lower case copy of the key is made.
+* All are transparent, with C++20 the containers can be searched with string_view or const char* without building a key
+*    std::unordered_map<std::string, int, IHash, IEqual> headers;
+*    headers["Content-Type"] = 1;
+*    headers.find("content-type")                        => found
+*    IHash()("Content-Type") == IHash()("CONTENT-TYPE")  => true
+*/
+struct Hash;
+
+struct IHash;
+
+struct Equal;
+
+struct IEqual;
+
+
 /**
 Helper class to avoid dynamic memory allocation of split functions
 maxSplits indicates how many splits to perform at most resulting in at most maxSplits + 1 elements
@@ -203,6 +277,13 @@ template<size_t maxSplits>
 template<size_t maxSplits>
 [[nodiscard]] inline SplitResult<std::string_view, maxSplits> splitAnyOf(std::string_view source, std::string_view separators);
 
+[[nodiscard]] inline std::vector<std::string_view> splitAnyOf(std::string_view source, const CharSet& separators);
+
+[[nodiscard]] inline std::vector<std::string_view> splitAnyOf(std::string_view source, const CharSet& separators, size_t maxSplits);
+
+template<size_t maxSplits>
+[[nodiscard]] inline SplitResult<std::string_view, maxSplits> splitAnyOf(std::string_view source, const CharSet& separators);
+
 
 /**
 * Splits source into substrings wherever any not of the separators occurs, and returns a list containing the substrings.
@@ -224,6 +305,13 @@ template<size_t maxSplits>
 template<size_t maxSplits>
 [[nodiscard]] inline SplitResult<std::string_view, maxSplits> splitAnyBut(std::string_view source, std::string_view separators);
 
+[[nodiscard]] inline std::vector<std::string_view> splitAnyBut(std::string_view source, const CharSet& separators);
+
+[[nodiscard]] inline std::vector<std::string_view> splitAnyBut(std::string_view source, const CharSet& separators, size_t maxSplits);
+
+template<size_t maxSplits>
+[[nodiscard]] inline SplitResult<std::string_view, maxSplits> splitAnyBut(std::string_view source, const CharSet& separators);
+
 /**
 * Splits source into substrings wherever the separator occurs, and returns a list containing the substrings.
 * If separator is not found in source a single-element list containing source is returned.
@@ -280,6 +368,13 @@ template<size_t maxSplits>
 
 template<size_t maxSplits>
 [[nodiscard]] inline SplitResult<std::string_view, maxSplits> splitAnyOfSkipEmpty(std::string_view source, std::string_view separators);
+
+[[nodiscard]] inline std::vector<std::string_view> splitAnyOfSkipEmpty(std::string_view source, const CharSet& separators);
+
+[[nodiscard]] inline std::vector<std::string_view> splitAnyOfSkipEmpty(std::string_view source, const CharSet& separators, size_t maxSplits);
+
+template<size_t maxSplits>
+[[nodiscard]] inline SplitResult<std::string_view, maxSplits> splitAnyOfSkipEmpty(std::string_view source, const CharSet& separators);
 /**
 * Splits source into substrings wherever any not of the separators occurs, and returns a list containing the substrings.
 * The string will be splitted at most maxSplits times
@@ -299,6 +394,263 @@ template<size_t maxSplits>
 
 template<size_t maxSplits>
 [[nodiscard]] inline SplitResult<std::string_view, maxSplits> splitAnyButSkipEmpty(std::string_view source, std::string_view separators);
+
+[[nodiscard]] inline std::vector<std::string_view> splitAnyButSkipEmpty(std::string_view source, const CharSet& separators);
+
+[[nodiscard]] inline std::vector<std::string_view> splitAnyButSkipEmpty(std::string_view source, const CharSet& separators, size_t maxSplits);
+
+template<size_t maxSplits>
+[[nodiscard]] inline SplitResult<std::string_view, maxSplits> splitAnyButSkipEmpty(std::string_view source, const CharSet& separators);
+
+
+/**
+* Lazy versions of the split functions above with the same separators, maxSplits and empty part rules
+* The parts are found one at a time while iterating, nothing is allocated and the loop can stop early.
+* The views are forward ranges for range-for and <ranges>, maxSplits is unlimited by default.
+*   for (std::string_view part : splitView("1|23|456", '|'))     => "1", "23", "456"
+*   splitView("1|2|3|4|5", "|", 2)                             => "1", "2", "3|4|5"
+*   splitAnyOfSkipEmptyView("a, b,,c", CharSet(", "))           => "a", "b", "c"
+*   splitView(line, ',') | std::views::take(2)                  => the first two fields only
+*/
+template<class Separator, bool skipEmpty>
+class SplitView;
+
+[[nodiscard]] constexpr SplitView<Detail::StringSeparator, false> splitView(std::string_view source, std::string_view separator, size_t maxSplits = INDEX_NOT_FOUND) noexcept;
+
+[[nodiscard]] constexpr SplitView<Detail::CharSeparator, false> splitView(std::string_view source, char separator, size_t maxSplits = INDEX_NOT_FOUND) noexcept;
+
+[[nodiscard]] constexpr SplitView<Detail::CharSetSeparator<false>, false> splitAnyOfView(std::string_view source, std::string_view separators, size_t maxSplits = INDEX_NOT_FOUND) noexcept;
+
+[[nodiscard]] constexpr SplitView<Detail::CharSetSeparator<false>, false> splitAnyOfView(std::string_view source, const CharSet& separators, size_t maxSplits = INDEX_NOT_FOUND) noexcept;
+
+[[nodiscard]] constexpr SplitView<Detail::CharSetSeparator<true>, false> splitAnyButView(std::string_view source, std::string_view separators, size_t maxSplits = INDEX_NOT_FOUND) noexcept;
+
+[[nodiscard]] constexpr SplitView<Detail::CharSetSeparator<true>, false> splitAnyButView(std::string_view source, const CharSet& separators, size_t maxSplits = INDEX_NOT_FOUND) noexcept;
+
+[[nodiscard]] constexpr SplitView<Detail::StringSeparator, true> splitSkipEmptyView(std::string_view source, std::string_view separator, size_t maxSplits = INDEX_NOT_FOUND) noexcept;
+
+[[nodiscard]] constexpr SplitView<Detail::CharSeparator, true> splitSkipEmptyView(std::string_view source, char separator, size_t maxSplits = INDEX_NOT_FOUND) noexcept;
+
+[[nodiscard]] constexpr SplitView<Detail::CharSetSeparator<false>, true> splitAnyOfSkipEmptyView(std::string_view source, std::string_view separators, size_t maxSplits = INDEX_NOT_FOUND) noexcept;
+
+[[nodiscard]] constexpr SplitView<Detail::CharSetSeparator<false>, true> splitAnyOfSkipEmptyView(std::string_view source, const CharSet& separators, size_t maxSplits = INDEX_NOT_FOUND) noexcept;
+
+[[nodiscard]] constexpr SplitView<Detail::CharSetSeparator<true>, true> splitAnyButSkipEmptyView(std::string_view source, std::string_view separators, size_t maxSplits = INDEX_NOT_FOUND) noexcept;
+
+[[nodiscard]] constexpr SplitView<Detail::CharSetSeparator<true>, true> splitAnyButSkipEmptyView(std::string_view source, const CharSet& separators, size_t maxSplits = INDEX_NOT_FOUND) noexcept;
+
+
+/**
+* A split result that stores one packed end offset per token instead of a std::string_view (16 bytes)
+* The offsets are 2 bytes wide for sources up to 64 KiB, else 4 (8 above 4 GiB), so the index is 4x to 8x smaller than a vector of views.
+* The tokens are counted first (vectorized for char separators), so the offsets are allocated once with the exact size.
+* operator[] and the iterators return views into the source, the source must outlive the index. Tokens are the same as split's.
+*   TokenIndex tokens("a,bb,,c", ',');          => tokens.size() == 4, tokens[1] == "bb", tokens.offsetBytes() == 2
+*   splitInto(tokens, line, ',');               => reuses the offsets of tokens
+*   for (std::string_view token : tokens)
+*/
+class TokenIndex;
+
+
+/**
+* Owning split results: all parts are copied into one block that holds the views and the chars, one allocation instead of one per part.
+* The splitOwned functions size the block by counting the separators first, they have the same parts as the matching split functions.
+* The parts outlive source, moving an OwnedSplit keeps the views valid. Any range of string_views can be copied with OwnedSplit(range),
+* in one allocation if the range has size() (vector, TokenIndex), a lazy range is collected into a temporary vector first.
+*   const OwnedSplit parts = splitOwned(line, ',');                   => parts[1] stays valid after line is gone
+*   splitAnyOfSkipEmptyOwned(text, CharSets::whitespace)              => the words of text, owned
+*   OwnedSplit(tokens)                                                => the tokens of a TokenIndex, owned
+*/
+class OwnedSplit;
+
+[[nodiscard]] inline OwnedSplit splitOwned(std::string_view source, std::string_view separator, size_t maxSplits = INDEX_NOT_FOUND);
+
+[[nodiscard]] inline OwnedSplit splitOwned(std::string_view source, char separator, size_t maxSplits = INDEX_NOT_FOUND);
+
+[[nodiscard]] inline OwnedSplit splitSkipEmptyOwned(std::string_view source, std::string_view separator, size_t maxSplits = INDEX_NOT_FOUND);
+
+[[nodiscard]] inline OwnedSplit splitSkipEmptyOwned(std::string_view source, char separator, size_t maxSplits = INDEX_NOT_FOUND);
+
+[[nodiscard]] inline OwnedSplit splitAnyOfOwned(std::string_view source, std::string_view separators, size_t maxSplits = INDEX_NOT_FOUND);
+
+[[nodiscard]] inline OwnedSplit splitAnyOfOwned(std::string_view source, const CharSet& separators, size_t maxSplits = INDEX_NOT_FOUND);
+
+[[nodiscard]] inline OwnedSplit splitAnyButOwned(std::string_view source, std::string_view separators, size_t maxSplits = INDEX_NOT_FOUND);
+
+[[nodiscard]] inline OwnedSplit splitAnyButOwned(std::string_view source, const CharSet& separators, size_t maxSplits = INDEX_NOT_FOUND);
+
+[[nodiscard]] inline OwnedSplit splitAnyOfSkipEmptyOwned(std::string_view source, std::string_view separators, size_t maxSplits = INDEX_NOT_FOUND);
+
+[[nodiscard]] inline OwnedSplit splitAnyOfSkipEmptyOwned(std::string_view source, const CharSet& separators, size_t maxSplits = INDEX_NOT_FOUND);
+
+[[nodiscard]] inline OwnedSplit splitAnyButSkipEmptyOwned(std::string_view source, std::string_view separators, size_t maxSplits = INDEX_NOT_FOUND);
+
+[[nodiscard]] inline OwnedSplit splitAnyButSkipEmptyOwned(std::string_view source, const CharSet& separators, size_t maxSplits = INDEX_NOT_FOUND);
+
+
+/**
+* Versions of the split functions above that reuse the caller's storage, maxSplits is unlimited by default
+* The vector overloads clear parts and refill it, its capacity is kept so a reused vector stops allocating.
+* The TokenIndex overloads reassign the index and reuse its offsets.
+* The OutputIterator overloads append the parts and return the iterator past the last one.
+*   std::vector<std::string_view> parts;
+*   for (std::string_view line : lines)
+*   {
+*       splitInto(parts, line, ',');                    => "1,2,3" gives parts ["1", "2", "3"]
+*   }
+*   splitSkipEmptyInto(std::back_inserter(all), "a||b", '|')   => appends "a", "b" to all
+*/
+inline void splitInto(std::vector<std::string_view>& parts, std::string_view source, std::string_view separator, size_t maxSplits = INDEX_NOT_FOUND);
+
+template<class OutputIterator>
+inline OutputIterator splitInto(OutputIterator output, std::string_view source, std::string_view separator, size_t maxSplits = INDEX_NOT_FOUND);
+
+inline void splitInto(std::vector<std::string_view>& parts, std::string_view source, char separator, size_t maxSplits = INDEX_NOT_FOUND);
+
+template<class OutputIterator>
+inline OutputIterator splitInto(OutputIterator output, std::string_view source, char separator, size_t maxSplits = INDEX_NOT_FOUND);
+
+inline void splitInto(TokenIndex& tokens, std::string_view source, std::string_view separator, size_t maxSplits = INDEX_NOT_FOUND);
+
+inline void splitInto(TokenIndex& tokens, std::string_view source, char separator, size_t maxSplits = INDEX_NOT_FOUND);
+
+inline void splitAnyOfInto(std::vector<std::string_view>& parts, std::string_view source, std::string_view separators, size_t maxSplits = INDEX_NOT_FOUND);
+
+template<class OutputIterator>
+inline OutputIterator splitAnyOfInto(OutputIterator output, std::string_view source, std::string_view separators, size_t maxSplits = INDEX_NOT_FOUND);
+
+inline void splitAnyOfInto(std::vector<std::string_view>& parts, std::string_view source, const CharSet& separators, size_t maxSplits = INDEX_NOT_FOUND);
+
+template<class OutputIterator>
+inline OutputIterator splitAnyOfInto(OutputIterator output, std::string_view source, const CharSet& separators, size_t maxSplits = INDEX_NOT_FOUND);
+
+inline void splitAnyButInto(std::vector<std::string_view>& parts, std::string_view source, std::string_view separators, size_t maxSplits = INDEX_NOT_FOUND);
+
+template<class OutputIterator>
+inline OutputIterator splitAnyButInto(OutputIterator output, std::string_view source, std::string_view separators, size_t maxSplits = INDEX_NOT_FOUND);
+
+inline void splitAnyButInto(std::vector<std::string_view>& parts, std::string_view source, const CharSet& separators, size_t maxSplits = INDEX_NOT_FOUND);
+
+template<class OutputIterator>
+inline OutputIterator splitAnyButInto(OutputIterator output, std::string_view source, const CharSet& separators, size_t maxSplits = INDEX_NOT_FOUND);
+
+inline void splitSkipEmptyInto(std::vector<std::string_view>& parts, std::string_view source, std::string_view separator, size_t maxSplits = INDEX_NOT_FOUND);
+
+template<class OutputIterator>
+inline OutputIterator splitSkipEmptyInto(OutputIterator output, std::string_view source, std::string_view separator, size_t maxSplits = INDEX_NOT_FOUND);
+
+inline void splitSkipEmptyInto(std::vector<std::string_view>& parts, std::string_view source, char separator, size_t maxSplits = INDEX_NOT_FOUND);
+
+template<class OutputIterator>
+inline OutputIterator splitSkipEmptyInto(OutputIterator output, std::string_view source, char separator, size_t maxSplits = INDEX_NOT_FOUND);
+
+inline void splitAnyOfSkipEmptyInto(std::vector<std::string_view>& parts, std::string_view source, std::string_view separators, size_t maxSplits = INDEX_NOT_FOUND);
+
+template<class OutputIterator>
+inline OutputIterator splitAnyOfSkipEmptyInto(OutputIterator output, std::string_view source, std::string_view separators, size_t maxSplits = INDEX_NOT_FOUND);
+
+inline void splitAnyOfSkipEmptyInto(std::vector<std::string_view>& parts, std::string_view source, const CharSet& separators, size_t maxSplits = INDEX_NOT_FOUND);
+
+template<class OutputIterator>
+inline OutputIterator splitAnyOfSkipEmptyInto(OutputIterator output, std::string_view source, const CharSet& separators, size_t maxSplits = INDEX_NOT_FOUND);
+
+inline void splitAnyButSkipEmptyInto(std::vector<std::string_view>& parts, std::string_view source, std::string_view separators, size_t maxSplits = INDEX_NOT_FOUND);
+
+template<class OutputIterator>
+inline OutputIterator splitAnyButSkipEmptyInto(OutputIterator output, std::string_view source, std::string_view separators, size_t maxSplits = INDEX_NOT_FOUND);
+
+inline void splitAnyButSkipEmptyInto(std::vector<std::string_view>& parts, std::string_view source, const CharSet& separators, size_t maxSplits = INDEX_NOT_FOUND);
+
+template<class OutputIterator>
+inline OutputIterator splitAnyButSkipEmptyInto(OutputIterator output, std::string_view source, const CharSet& separators, size_t maxSplits = INDEX_NOT_FOUND);
+
+
+/**
+* Splits delimited records (CSV, TSV) at the separators that are not inside quotes and not escaped
+* A quote char toggles quoting, so a doubled quote inside quotes ("a""b") is a literal quote. If escapeChar differs from quoteChar it
+* makes the next char literal, also outside of quotes. splitQuoted returns the fields as they are in source, quotes included.
+* splitQuotedUnescaped removes the quotes and escapes, the fields that had any are written to buffer (cleared, its capacity is reused),
+* the others stay views into source. The 64 char blocks are scanned with bitmasks, the quoted regions are their prefix xor.
+* Splitting at '\n' first gives the records, quoted line breaks stay inside their field.
+*   splitQuoted(R"(a,"b,c",d)", ',')                           => ["a", "\"b,c\"", "d"]
+*   splitQuotedUnescaped(R"(a,"b,c","d""e")", buffer, ',')     => ["a", "b,c", "d\"e"]
+*   splitQuotedUnescaped(R"(a\,b,c)", buffer, ',', '"', '\\')   => ["a,b", "c"]
+*/
+[[nodiscard]] inline std::vector<std::string_view> splitQuoted(std::string_view source, char separator, char quoteChar = '"', char escapeChar = '"');
+
+[[nodiscard]] inline std::vector<std::string_view> splitQuotedUnescaped(std::string_view source, std::string& buffer, char separator, char quoteChar = '"', char escapeChar = '"');
+
+
+/**
+* Splits source into exactly one field per type and parses each field as it is found, without a vector in between
+* Returns std::nullopt if there are more or fewer fields or a field does not parse completely
+* Supported are std::string_view, std::string, char, bool ("true"/"false"/"1"/"0"), integers and floating point numbers,
+* other types (wchar_t, char16_t, char32_t and char8_t too) need a specialization of Custom::fromStringImpl<T> with bool operator()(std::string_view field, T& value) const
+* Floating point numbers are parsed independent of the locale, unless the standard library has no floating point std::from_chars,
+* then std::strtold is used, which expects the decimal point of the current C locale
+*   splitAs<int, std::string_view, double>("42,abc,1.5", ',')    => std::tuple{42, "abc", 1.5}
+*   splitAs<int, int>("1,2,3", ',')                             => std::nullopt
+*   splitAs<int, int>("1,x", ',')                               => std::nullopt
+*   if (const auto record = splitAs<int, double>(line, "; ")) { const auto [id, price] = *record; }
+*/
+template<typename... Types>
+[[nodiscard]] inline std::optional<std::tuple<Types...>> splitAs(std::string_view source, char separator);
+
+template<typename... Types>
+[[nodiscard]] inline std::optional<std::tuple<Types...>> splitAs(std::string_view source, std::string_view separator);
+
+
+/**
+* Parses "key=value" pairs (query strings, cookies, log attributes) lazily, every pair is a KeyValue of two views into source.
+* One block scan for either separator splits the pairs, the value runs to the next pairSeparator and may contain keyValueSeparator.
+* A pair without keyValueSeparator has an empty value, pairs with an empty key are skipped. stripWhitespace strips keys and values.
+* parseKeyValueInto clears pairs and refills it as a flat map in source order (duplicate keys are kept), its capacity is reused.
+*   parseKeyValue("a=1&b=2", '&', '=')                        => [{"a", "1"}, {"b", "2"}]
+*   parseKeyValue("id=7; flag; ; t=a=b", ';', '=', true)      => [{"id", "7"}, {"flag", ""}, {"t", "a=b"}]
+*   parseKeyValue(" = ;=x;a=1", ';', '=', true)               => [{"a", "1"}]
+*   for (const auto& [key, value] : parseKeyValue(cookie, ';', '=', true))
+*/
+struct KeyValue;
+
+class KeyValueView;
+
+[[nodiscard]] constexpr KeyValueView parseKeyValue(std::string_view source, char pairSeparator, char keyValueSeparator, bool stripWhitespace = false) noexcept;
+
+inline void parseKeyValueInto(std::vector<KeyValue>& pairs, std::string_view source, char pairSeparator, char keyValueSeparator, bool stripWhitespace = false);
+
+
+/**
+* Splits input that arrives in chunks (socket reads, pipes, file blocks) with the rules of split and splitSkipEmpty
+* feed calls onPart(std::string_view) for every part completed by the chunk, flush for the last part, then the splitter can be reused.
+* The parts inside a chunk are views into it, only the unfinished last part is copied to an internal buffer.
+* The views are valid during the call of onPart only. Separators may cross chunk boundaries.
+* A CharSet splits like splitAnyOf, ~separators like splitAnyBut.
+*   StreamSplitter splitter('\n');
+*   splitter.feed("ab\ncd", onPart);             => onPart("ab")
+*   splitter.feed("e\n", onPart);                => onPart("cde")
+*   splitter.flush(onPart);                      => onPart("")
+*
+*   StreamSplitter skipEmpty("\r\n", true);
+*   skipEmpty.feed("a\r", onPart);               => nothing
+*   skipEmpty.feed("\n\r\nb", onPart);           => onPart("a")
+*   skipEmpty.flush(onPart);                     => onPart("b")
+*/
+class StreamSplitter;
+
+
+#if STRINGUTILS_HAS_MMAP
+/**
+* Maps a whole regular file read only (mmap with MADV_SEQUENTIAL), nothing is copied and only the touched pages are resident
+* isOpen() is false if the file can not be opened or mapped. The views live as long as the MappedFile.
+* lines() splits like split(view(), '\n') without the empty part after a final newline, a '\r' before it is kept. An empty file has no lines.
+* tokens(separators) splits like splitAnyOfSkipEmpty(view(), separators).
+*   const MappedFile file("/var/log/app.log");
+*   for (std::string_view line : file.lines())               => one view per line
+*   for (std::string_view word : file.tokens(CharSets::whitespace))
+*   count(file.view(), '\n')                                 => number of newlines
+*/
+class MappedFile;
+#endif
 //#######################################################################################
 //
 //                                  Find
@@ -313,6 +665,33 @@ template<size_t maxSplits>
 
 [[nodiscard]] constexpr size_t findAnyBut(const std::string_view hayStack, const std::string_view needles, const size_t startIndex = 0) noexcept;
 
+[[nodiscard]] constexpr size_t findAnyOf(const std::string_view hayStack, const CharSet& needles, const size_t startIndex = 0) noexcept;
+
+[[nodiscard]] constexpr size_t findAnyBut(const std::string_view hayStack, const CharSet& needles, const size_t startIndex = 0) noexcept;
+
+/**
+* Reverse searches, same as string_view::rfind, find_last_of and find_last_not_of
+* startIndex is the last position considered, by default the whole hayStack is searched
+*   rFind("a/b/c.tar.gz", '/')            => 3
+*   rFind("a/b/c.tar.gz", ".")            => 9
+*   rFind("a/b/c.tar.gz", ".", 8)         => 5
+*   rFind("abc", "")                      => 3
+*   rFindAnyOf("a/b\\c", "/\\")           => 3
+*   rFindAnyBut("abc   ", whitespace)     => 2
+*   rFindAnyBut("   ", whitespace)        => INDEX_NOT_FOUND
+*/
+[[nodiscard]] constexpr size_t rFind(const std::string_view hayStack, const std::string_view needle, const size_t startIndex = INDEX_NOT_FOUND) noexcept;
+
+[[nodiscard]] constexpr size_t rFind(const std::string_view hayStack, const char needle, const size_t startIndex = INDEX_NOT_FOUND) noexcept;
+
+[[nodiscard]] constexpr size_t rFindAnyOf(const std::string_view hayStack, const std::string_view needles, const size_t startIndex = INDEX_NOT_FOUND) noexcept;
+
+[[nodiscard]] constexpr size_t rFindAnyBut(const std::string_view hayStack, const std::string_view needles, const size_t startIndex = INDEX_NOT_FOUND) noexcept;
+
+[[nodiscard]] constexpr size_t rFindAnyOf(const std::string_view hayStack, const CharSet& needles, const size_t startIndex = INDEX_NOT_FOUND) noexcept;
+
+[[nodiscard]] constexpr size_t rFindAnyBut(const std::string_view hayStack, const CharSet& needles, const size_t startIndex = INDEX_NOT_FOUND) noexcept;
+
 //#######################################################################################
 //
 //                                  Find case insensitive
@@ -327,6 +706,19 @@ template<size_t maxSplits>
 
 [[nodiscard]] constexpr size_t iFindAnyBut(const std::string_view hayStack, const std::string_view needles, const size_t startIndex = 0) noexcept;
 
+/**
+*   irFind("a.TXT.txt", ".Txt")           => 5
+*   irFind("a.TXT.txt", ".Txt", 4)        => 1
+*   irFindAnyOf("aXbx", "X")              => 3
+*/
+[[nodiscard]] constexpr size_t irFind(const std::string_view hayStack, const std::string_view needle, const size_t startIndex = INDEX_NOT_FOUND) noexcept;
+
+[[nodiscard]] constexpr size_t irFind(const std::string_view hayStack, const char needle, const size_t startIndex = INDEX_NOT_FOUND) noexcept;
+
+[[nodiscard]] constexpr size_t irFindAnyOf(const std::string_view hayStack, const std::string_view needles, const size_t startIndex = INDEX_NOT_FOUND) noexcept;
+
+[[nodiscard]] constexpr size_t irFindAnyBut(const std::string_view hayStack, const std::string_view needles, const size_t startIndex = INDEX_NOT_FOUND) noexcept;
+
 
 //#######################################################################################
 //
@@ -343,6 +735,27 @@ template<size_t maxSplits>
 
 [[nodiscard]] constexpr bool containsOnly(const std::string_view hayStack, const std::string_view needles) noexcept;
 
+[[nodiscard]] constexpr bool containsAnyOf(const std::string_view hayStack, const CharSet& needles) noexcept;
+
+[[nodiscard]] constexpr bool containsNoneOf(const std::string_view hayStack, const CharSet& needles) noexcept;
+
+[[nodiscard]] constexpr bool containsOnly(const std::string_view hayStack, const CharSet& needles) noexcept;
+
+/**
+* Overloads matching whole needles instead of single chars, see MultiSearcher
+*   containsAnyOf("a blocked word", MultiSearcher{ "blocked", "banned" })  => true
+*   findAnyOf("a blocked word", MultiSearcher{ "blocked", "banned" })      => 2
+*   findAnyOf("abcd", MultiSearcher{ "abcd", "bc" })                       => 0
+*/
+template<bool ignoreCase>
+[[nodiscard]] inline size_t findAnyOf(const std::string_view hayStack, const BasicMultiSearcher<ignoreCase>& needles, const size_t startIndex = 0) noexcept;
+
+template<bool ignoreCase>
+[[nodiscard]] inline bool containsAnyOf(const std::string_view hayStack, const BasicMultiSearcher<ignoreCase>& needles) noexcept;
+
+template<bool ignoreCase>
+[[nodiscard]] inline bool containsNoneOf(const std::string_view hayStack, const BasicMultiSearcher<ignoreCase>& needles) noexcept;
+
 //#######################################################################################
 //
 //                               Contains case insensitive
@@ -358,6 +771,218 @@ template<size_t maxSplits>
 
 [[nodiscard]] constexpr bool iContainsOnly(const std::string_view hayStack, const std::string_view needles) noexcept;
 
+
+//#######################################################################################
+//
+//                                      Count
+//
+//#######################################################################################
+
+
+/**
+* Counts the non overlapping occurrences of needle, an empty needle matches hayStack.size() + 1 times
+*   count("a\nb\nc", '\n')            => 2
+*   count("aaaa", "aa")                => 2
+*   count("abc", "")                   => 4
+*   countAnyOf("a,b;c", ",;")          => 2
+*   countAnyOf("a1b22", digits)        => 3
+*/
+[[nodiscard]] constexpr size_t count(const std::string_view hayStack, const char needle) noexcept;
+
+[[nodiscard]] constexpr size_t count(const std::string_view hayStack, const std::string_view needle) noexcept;
+
+[[nodiscard]] constexpr size_t countAnyOf(const std::string_view hayStack, const std::string_view needles) noexcept;
+
+[[nodiscard]] constexpr size_t countAnyOf(const std::string_view hayStack, const CharSet& needles) noexcept;
+
+
+/**
+* Writes the index of every match of count(hayStack, needle) to output and returns the advanced output
+* Use count to pre-size the destination
+*   findAll("a\nb\nc", '\n')                                  => [1, 3]
+*   findAll("aaaa", "aa")                                      => [0, 2]
+*   positions.reserve(count(text, '\n'));
+*   findAll(text, '\n', std::back_inserter(positions));
+*/
+template<class OutputIterator>
+inline OutputIterator findAll(std::string_view hayStack, char needle, OutputIterator output);
+
+template<class OutputIterator>
+inline OutputIterator findAll(std::string_view hayStack, std::string_view needle, OutputIterator output);
+
+[[nodiscard]] inline std::vector<size_t> findAll(std::string_view hayStack, char needle);
+
+[[nodiscard]] inline std::vector<size_t> findAll(std::string_view hayStack, std::string_view needle);
+
+
+//#######################################################################################
+//
+//                                      Searcher
+//
+//#######################################################################################
+
+
+/**
+* Precompiled needle for repeated searches, all per needle state is computed once in the constructor
+* The needle is not copied and must outlive the searcher. Can be constructed at compile time.
+*   constexpr Searcher searcher("ERROR");
+*   searcher.find("[ERROR] x", 0)           => 1
+*   searcher.contains("[INFO] x")           => false
+*   searcher.count("ERROR ERROR")           => 2
+*   searcher.split("aERRORb")               => ["a", "b"]
+*   searcher.split("aERRORbERRORc", 1)      => ["a", "bERRORc"]
+*
+*   constexpr ISearcher iSearcher("error");
+*   iSearcher.find("[ERROR] x", 0)          => 1
+*/
+template<bool ignoreCase>
+class BasicSearcher;
+
+using Searcher = BasicSearcher<false>;
+
+using ISearcher = BasicSearcher<true>;
+
+
+//#######################################################################################
+//
+//                                      MultiSearcher
+//
+//#######################################################################################
+
+
+/**
+* Result of a MultiSearcher, position is INDEX_NOT_FOUND if nothing was found
+*/
+struct MultiMatch;
+
+/**
+* Searches for many needles at once in a single pass over the hayStack (Aho-Corasick)
+* The needles are copied into the automaton, empty needles never match
+* find returns the leftmost match, the longest if several start there. A repeated needle is reported with the index of its first copy.
+*   const MultiSearcher searcher{ "he", "she", "hers" };
+*   searcher.find("ushers")             => { position: 1, size: 3, needleIndex: 1 }
+*   MultiSearcher{ "abcd", "bc" }.find("abcd")         => { position: 0, size: 4, needleIndex: 0 }
+*   MultiSearcher{ "b", "abc", "ab" }.find("abc")      => { position: 0, size: 3, needleIndex: 1 }
+*   searcher.contains("his")            => false
+*   searcher.findAll("ushers")          => [{ 1, 3, 1 }, { 2, 2, 0 }, { 2, 4, 2 }]
+*
+*   const IMultiSearcher iSearcher{ "error", "warn" };
+*   iSearcher.find("a WARNING")         => { position: 2, size: 4, needleIndex: 1 }
+*/
+template<bool ignoreCase>
+class BasicMultiSearcher;
+
+using MultiSearcher = BasicMultiSearcher<false>;
+
+using IMultiSearcher = BasicMultiSearcher<true>;
+
+
+//#######################################################################################
+//
+//                                      Hash
+//
+//#######################################################################################
+
+
+/**
+* Fast non cryptographic hash (wyhash style), the functors Hash and IHash use it with seed 0
+* The values are the same on every platform and stay stable across versions, so they may be persisted.
+* Usable at compile time. The i versions ignore case like iEquals.
+*   hash64("abc") == hash64("abc")                 => true
+*   hash64("abc") == hash64("abc", 1)              => false
+*   iHash64("Content-Type") == hash64("content-type")  => true
+*   constexpr uint64_t key = hash64("GET");
+*/
+[[nodiscard]] constexpr uint64_t hash64(std::string_view str, uint64_t seed = 0) noexcept;
+
+[[nodiscard]] constexpr uint64_t iHash64(std::string_view str, uint64_t seed = 0) noexcept;
+
+/**
+* 128 bit hash for content addressing and deduplication of large sets, the low half is hash64(str, seed)
+*   hash128("abc").low == hash64("abc")            => true
+*/
+struct Hash128;
+
+[[nodiscard]] constexpr Hash128 hash128(std::string_view str, uint64_t seed = 0) noexcept;
+
+[[nodiscard]] constexpr Hash128 iHash128(std::string_view str, uint64_t seed = 0) noexcept;
+
+/**
+* Incremental hash64 of input arriving in chunks, the digest equals hash64 of the concatenated chunks
+* Only the last 48 bytes are buffered, the chunks need not outlive the update call.
+*   Hasher hasher;
+*   hasher.update("Content-").update("Type");
+*   hasher.digest() == hash64("Content-Type")      => true
+*   hasher.reset();                                => hashes the next input with seed 0
+*
+*   IHasher iHasher;
+*   iHasher.update("CONTENT-TYPE").digest() == iHash64("content-type")  => true
+*/
+template<bool ignoreCase>
+class BasicHasher;
+
+using Hasher = BasicHasher<false>;
+
+using IHasher = BasicHasher<true>;
+
+
+//#######################################################################################
+//
+//                                      Batch
+//
+//#######################################################################################
+
+
+/**
+* Tests a column of hayStacks against one needle, bit i of the result is set if hayStacks[i] matches:
+*   (matches[i / 64] >> (i % 64)) & 1
+* The pointer overloads write (count + 63) / 64 words to matches.
+* The needle is prepared once (see Searcher) and the data of the following hayStacks is prefetched.
+* With threadCount > 1 the column is split across that many threads, which pays off for large columns only.
+* Define STRINGUTILS_NO_THREADS to always run on the calling thread.
+*   containsBatch({ "a.com/x", "b.org", "c.com" }, ".com")         => { 0b101 }
+*   startsWithBatch({ "https://a", "http://b" }, "https")         => { 0b01 }
+*   containsBatch(urls.data(), urls.size(), ".com", bits.data(), 4);
+*/
+inline void containsBatch(const std::string_view* hayStacks, size_t count, std::string_view needle, uint64_t* matches, size_t threadCount = 1);
+
+inline void iContainsBatch(const std::string_view* hayStacks, size_t count, std::string_view needle, uint64_t* matches, size_t threadCount = 1);
+
+inline void startsWithBatch(const std::string_view* hayStacks, size_t count, std::string_view prefix, uint64_t* matches, size_t threadCount = 1);
+
+inline void iStartsWithBatch(const std::string_view* hayStacks, size_t count, std::string_view prefix, uint64_t* matches, size_t threadCount = 1);
+
+inline void endsWithBatch(const std::string_view* hayStacks, size_t count, std::string_view suffix, uint64_t* matches, size_t threadCount = 1);
+
+inline void iEndsWithBatch(const std::string_view* hayStacks, size_t count, std::string_view suffix, uint64_t* matches, size_t threadCount = 1);
+
+[[nodiscard]] inline std::vector<uint64_t> containsBatch(const std::vector<std::string_view>& hayStacks, std::string_view needle, size_t threadCount = 1);
+
+[[nodiscard]] inline std::vector<uint64_t> iContainsBatch(const std::vector<std::string_view>& hayStacks, std::string_view needle, size_t threadCount = 1);
+
+[[nodiscard]] inline std::vector<uint64_t> startsWithBatch(const std::vector<std::string_view>& hayStacks, std::string_view prefix, size_t threadCount = 1);
+
+[[nodiscard]] inline std::vector<uint64_t> iStartsWithBatch(const std::vector<std::string_view>& hayStacks, std::string_view prefix, size_t threadCount = 1);
+
+[[nodiscard]] inline std::vector<uint64_t> endsWithBatch(const std::vector<std::string_view>& hayStacks, std::string_view suffix, size_t threadCount = 1);
+
+[[nodiscard]] inline std::vector<uint64_t> iEndsWithBatch(const std::vector<std::string_view>& hayStacks, std::string_view suffix, size_t threadCount = 1);
+
+
+/**
+* Same result as split(source, separator), computed on up to threadCount threads for large sources
+* The source is cut into chunks and each cut is moved forward to a separator that split cuts at as well, the chunks are then
+* split concurrently and their parts concatenated in order. Separators that overlap themselves (e.g. "aa") are handled.
+* ParallelSchedule::Static gives every thread one chunk, ParallelSchedule::Dynamic cuts many more chunks and an idle thread
+* takes the next one, which balances sources where the density of separators varies a lot.
+* Chunks are at least 64 KiB, smaller sources are split on the calling thread. Define STRINGUTILS_NO_THREADS to always do so.
+*   parallelSplit(log, '\n', 8)                                 => split(log, '\n')
+*   parallelSplit(csv, "\r\n", 8, ParallelSchedule::Dynamic)     => split(csv, "\r\n")
+*/
+[[nodiscard]] inline std::vector<std::string_view> parallelSplit(std::string_view source, char separator, size_t threadCount, ParallelSchedule schedule = ParallelSchedule::Static);
+
+[[nodiscard]] inline std::vector<std::string_view> parallelSplit(std::string_view source, std::string_view separator, size_t threadCount, ParallelSchedule schedule = ParallelSchedule::Static);
+
 //#######################################################################################
 //
 //                                      EndsWith
@@ -473,6 +1098,8 @@ template<typename T>
 
 [[nodiscard]] constexpr inline std::string_view stripEnd(std::string_view str, std::string_view stripChars) noexcept;
 
+[[nodiscard]] constexpr inline std::string_view stripEnd(std::string_view str, const CharSet& stripChars) noexcept;
+
 
 /**
 * Strips any of a set of characters from the start of a string
@@ -487,6 +1114,8 @@ template<typename T>
 */
 [[nodiscard]] constexpr inline std::string_view stripStart(std::string_view str, std::string_view stripChars) noexcept;
 
+[[nodiscard]] constexpr inline std::string_view stripStart(std::string_view str, const CharSet& stripChars) noexcept;
+
 
 /**
 * Strips any of a set of characters from the start and end of a string
@@ -502,6 +1131,8 @@ template<typename T>
 */
 [[nodiscard]] constexpr inline std::string_view strip(std::string_view str, std::string_view stripChars) noexcept;
 
+[[nodiscard]] constexpr inline std::string_view strip(std::string_view str, const CharSet& stripChars) noexcept;
+
 
 //#######################################################################################
 //
@@ -78,6 +78,17 @@ template<typename... Args>
 }
 
 
+[[nodiscard]] constexpr int compare(const std::string_view str1, const std::string_view str2) noexcept
+{
+    return str1.compare(str2);
+}
+
+[[nodiscard]] constexpr int iCompare(const std::string_view str1, const std::string_view str2) noexcept
+{
+    return Detail::iCompare(str1.data(), str1.size(), str2.data(), str2.size());
+}
+
+
 //#######################################################################################
 //
 //                                  Split
@@ -106,22 +117,22 @@ template<typename... Args>
 
 [[nodiscard]] inline std::vector<std::string_view> splitAnyOf(const std::string_view source, const std::string_view separators)
 {
-    return Detail::splitAnyOf<std::string_view, std::string_view>(source, separators);
+    return Detail::splitAnyOf<std::string_view, std::string_view>(source, CharSet(separators));
 }
 
 [[nodiscard]] inline std::vector<std::string_view> splitAnyOf(const std::string_view source, const std::string_view separators, const size_t maxSplits)
 {
-    return Detail::splitAnyOf<std::string_view, std::string_view>(source, separators, maxSplits);
+    return Detail::splitAnyOf<std::string_view, std::string_view>(source, CharSet(separators), maxSplits);
 }
 
 [[nodiscard]] inline std::vector<std::string_view> splitAnyBut(const std::string_view source, const std::string_view separators)
 {
-    return Detail::splitAnyBut<std::string_view, std::string_view>(source, separators);
+    return Detail::splitAnyBut<std::string_view, std::string_view>(source, CharSet(separators));
 }
 
 [[nodiscard]] inline std::vector<std::string_view> splitAnyBut(const std::string_view source, const std::string_view separators, const size_t maxSplits)
 {
-    return Detail::splitAnyBut<std::string_view, std::string_view>(source, separators, maxSplits);
+    return Detail::splitAnyBut<std::string_view, std::string_view>(source, CharSet(separators), maxSplits);
 }
 
 
@@ -139,12 +150,44 @@ template<size_t maxSplits>
 
 template<size_t maxSplits>
 [[nodiscard]] inline SplitResult<std::string_view, maxSplits> splitAnyOf(const std::string_view source, const std::string_view separators)
+{
+    return Detail::splitAnyOf<std::string_view, std::string_view, maxSplits>(source, CharSet(separators));
+}
+
+[[nodiscard]] inline std::vector<std::string_view> splitAnyOf(const std::string_view source, const CharSet& separators)
+{
+    return Detail::splitAnyOf<std::string_view, std::string_view>(source, separators);
+}
+
+[[nodiscard]] inline std::vector<std::string_view> splitAnyOf(const std::string_view source, const CharSet& separators, const size_t maxSplits)
+{
+    return Detail::splitAnyOf<std::string_view, std::string_view>(source, separators, maxSplits);
+}
+
+template<size_t maxSplits>
+[[nodiscard]] inline SplitResult<std::string_view, maxSplits> splitAnyOf(const std::string_view source, const CharSet& separators)
 {
     return Detail::splitAnyOf<std::string_view, std::string_view, maxSplits>(source, separators);
 }
 
 template<size_t maxSplits>
 [[nodiscard]] inline SplitResult<std::string_view, maxSplits> splitAnyBut(const std::string_view source, const std::string_view separators)
+{
+    return Detail::splitAnyBut<std::string_view, std::string_view, maxSplits>(source, CharSet(separators));
+}
+
+[[nodiscard]] inline std::vector<std::string_view> splitAnyBut(const std::string_view source, const CharSet& separators)
+{
+    return Detail::splitAnyBut<std::string_view, std::string_view>(source, separators);
+}
+
+[[nodiscard]] inline std::vector<std::string_view> splitAnyBut(const std::string_view source, const CharSet& separators, const size_t maxSplits)
+{
+    return Detail::splitAnyBut<std::string_view, std::string_view>(source, separators, maxSplits);
+}
+
+template<size_t maxSplits>
+[[nodiscard]] inline SplitResult<std::string_view, maxSplits> splitAnyBut(const std::string_view source, const CharSet& separators)
 {
     return Detail::splitAnyBut<std::string_view, std::string_view, maxSplits>(source, separators);
 }
@@ -195,17 +238,33 @@ template<size_t maxSplits>
 
 [[nodiscard]] inline std::vector<std::string_view> splitAnyOfSkipEmpty(const std::string_view source, const std::string_view separators)
 {
-    return Detail::splitAnyOfSkipEmpty<std::string_view, std::string_view>(source, separators);
+    return Detail::splitAnyOfSkipEmpty<std::string_view, std::string_view>(source, CharSet(separators));
 }
 
 
 [[nodiscard]] inline std::vector<std::string_view> splitAnyOfSkipEmpty(const std::string_view source, const std::string_view separators, const size_t maxSplits)
 {
-    return Detail::splitAnyOfSkipEmpty<std::string_view, std::string_view>(source, separators, maxSplits);
+    return Detail::splitAnyOfSkipEmpty<std::string_view, std::string_view>(source, CharSet(separators), maxSplits);
 }
 
 template<size_t maxSplits>
 [[nodiscard]] inline SplitResult<std::string_view, maxSplits> splitAnyOfSkipEmpty(const std::string_view source, const std::string_view separators)
+{
+    return Detail::splitAnyOfSkipEmpty<std::string_view, std::string_view, maxSplits>(source, CharSet(separators));
+}
+
+[[nodiscard]] inline std::vector<std::string_view> splitAnyOfSkipEmpty(const std::string_view source, const CharSet& separators)
+{
+    return Detail::splitAnyOfSkipEmpty<std::string_view, std::string_view>(source, separators);
+}
+
+[[nodiscard]] inline std::vector<std::string_view> splitAnyOfSkipEmpty(const std::string_view source, const CharSet& separators, const size_t maxSplits)
+{
+    return Detail::splitAnyOfSkipEmpty<std::string_view, std::string_view>(source, separators, maxSplits);
+}
+
+template<size_t maxSplits>
+[[nodiscard]] inline SplitResult<std::string_view, maxSplits> splitAnyOfSkipEmpty(const std::string_view source, const CharSet& separators)
 {
     return Detail::splitAnyOfSkipEmpty<std::string_view, std::string_view, maxSplits>(source, separators);
 }
@@ -213,23 +272,382 @@ template<size_t maxSplits>
 
 [[nodiscard]] inline std::vector<std::string_view> splitAnyButSkipEmpty(const std::string_view source, const std::string_view separators)
 {
-    return Detail::splitAnyButSkipEmpty<std::string_view, std::string_view>(source, separators);
+    return Detail::splitAnyButSkipEmpty<std::string_view, std::string_view>(source, CharSet(separators));
 }
 
 
 [[nodiscard]] inline std::vector<std::string_view> splitAnyButSkipEmpty(const std::string_view source, const std::string_view separators, const size_t maxSplits)
 {
-    return Detail::splitAnyButSkipEmpty<std::string_view, std::string_view>(source, separators, maxSplits);
+    return Detail::splitAnyButSkipEmpty<std::string_view, std::string_view>(source, CharSet(separators), maxSplits);
 }
 
 
 template<size_t maxSplits>
 [[nodiscard]] inline SplitResult<std::string_view, maxSplits> splitAnyButSkipEmpty(const std::string_view source, const std::string_view separators)
+{
+    return Detail::splitAnyButSkipEmpty<std::string_view, std::string_view, maxSplits>(source, CharSet(separators));
+}
+
+[[nodiscard]] inline std::vector<std::string_view> splitAnyButSkipEmpty(const std::string_view source, const CharSet& separators)
+{
+    return Detail::splitAnyButSkipEmpty<std::string_view, std::string_view>(source, separators);
+}
+
+[[nodiscard]] inline std::vector<std::string_view> splitAnyButSkipEmpty(const std::string_view source, const CharSet& separators, const size_t maxSplits)
+{
+    return Detail::splitAnyButSkipEmpty<std::string_view, std::string_view>(source, separators, maxSplits);
+}
+
+template<size_t maxSplits>
+[[nodiscard]] inline SplitResult<std::string_view, maxSplits> splitAnyButSkipEmpty(const std::string_view source, const CharSet& separators)
 {
     return Detail::splitAnyButSkipEmpty<std::string_view, std::string_view, maxSplits>(source, separators);
 }
 
 
+//#######################################################################################
+//
+//                                      SplitView
+//
+//#######################################################################################
+
+[[nodiscard]] constexpr SplitView<Detail::StringSeparator, false> splitView(const std::string_view source, const std::string_view separator, const size_t maxSplits) noexcept
+{
+    return SplitView<Detail::StringSeparator, false>(source, Detail::StringSeparator{ separator, {} }, maxSplits);
+}
+
+[[nodiscard]] constexpr SplitView<Detail::CharSeparator, false> splitView(const std::string_view source, const char separator, const size_t maxSplits) noexcept
+{
+    return SplitView<Detail::CharSeparator, false>(source, Detail::CharSeparator{ separator }, maxSplits);
+}
+
+[[nodiscard]] constexpr SplitView<Detail::CharSetSeparator<false>, false> splitAnyOfView(const std::string_view source, const std::string_view separators, const size_t maxSplits) noexcept
+{
+    return SplitView<Detail::CharSetSeparator<false>, false>(source, Detail::CharSetSeparator<false>{ CharSet(separators) }, maxSplits);
+}
+
+[[nodiscard]] constexpr SplitView<Detail::CharSetSeparator<false>, false> splitAnyOfView(const std::string_view source, const CharSet& separators, const size_t maxSplits) noexcept
+{
+    return SplitView<Detail::CharSetSeparator<false>, false>(source, Detail::CharSetSeparator<false>{ separators }, maxSplits);
+}
+
+[[nodiscard]] constexpr SplitView<Detail::CharSetSeparator<true>, false> splitAnyButView(const std::string_view source, const std::string_view separators, const size_t maxSplits) noexcept
+{
+    return SplitView<Detail::CharSetSeparator<true>, false>(source, Detail::CharSetSeparator<true>{ CharSet(separators) }, maxSplits);
+}
+
+[[nodiscard]] constexpr SplitView<Detail::CharSetSeparator<true>, false> splitAnyButView(const std::string_view source, const CharSet& separators, const size_t maxSplits) noexcept
+{
+    return SplitView<Detail::CharSetSeparator<true>, false>(source, Detail::CharSetSeparator<true>{ separators }, maxSplits);
+}
+
+[[nodiscard]] constexpr SplitView<Detail::StringSeparator, true> splitSkipEmptyView(const std::string_view source, const std::string_view separator, const size_t maxSplits) noexcept
+{
+    return SplitView<Detail::StringSeparator, true>(source, Detail::StringSeparator{ separator, {} }, maxSplits);
+}
+
+[[nodiscard]] constexpr SplitView<Detail::CharSeparator, true> splitSkipEmptyView(const std::string_view source, const char separator, const size_t maxSplits) noexcept
+{
+    return SplitView<Detail::CharSeparator, true>(source, Detail::CharSeparator{ separator }, maxSplits);
+}
+
+[[nodiscard]] constexpr SplitView<Detail::CharSetSeparator<false>, true> splitAnyOfSkipEmptyView(const std::string_view source, const std::string_view separators, const size_t maxSplits) noexcept
+{
+    return SplitView<Detail::CharSetSeparator<false>, true>(source, Detail::CharSetSeparator<false>{ CharSet(separators) }, maxSplits);
+}
+
+[[nodiscard]] constexpr SplitView<Detail::CharSetSeparator<false>, true> splitAnyOfSkipEmptyView(const std::string_view source, const CharSet& separators, const size_t maxSplits) noexcept
+{
+    return SplitView<Detail::CharSetSeparator<false>, true>(source, Detail::CharSetSeparator<false>{ separators }, maxSplits);
+}
+
+[[nodiscard]] constexpr SplitView<Detail::CharSetSeparator<true>, true> splitAnyButSkipEmptyView(const std::string_view source, const std::string_view separators, const size_t maxSplits) noexcept
+{
+    return SplitView<Detail::CharSetSeparator<true>, true>(source, Detail::CharSetSeparator<true>{ CharSet(separators) }, maxSplits);
+}
+
+[[nodiscard]] constexpr SplitView<Detail::CharSetSeparator<true>, true> splitAnyButSkipEmptyView(const std::string_view source, const CharSet& separators, const size_t maxSplits) noexcept
+{
+    return SplitView<Detail::CharSetSeparator<true>, true>(source, Detail::CharSetSeparator<true>{ separators }, maxSplits);
+}
+
+
+inline void splitInto(std::vector<std::string_view>& parts, const std::string_view source, const std::string_view separator, const size_t maxSplits)
+{
+    parts.clear();
+    splitInto(std::back_inserter(parts), source, separator, maxSplits);
+}
+
+template<class OutputIterator>
+inline OutputIterator splitInto(OutputIterator output, const std::string_view source, const std::string_view separator, const size_t maxSplits)
+{
+    const auto view = splitView(source, separator, maxSplits);
+    return std::copy(view.begin(), view.end(), output);
+}
+
+inline void splitInto(std::vector<std::string_view>& parts, const std::string_view source, const char separator, const size_t maxSplits)
+{
+    parts.clear();
+    splitInto(std::back_inserter(parts), source, separator, maxSplits);
+}
+
+template<class OutputIterator>
+inline OutputIterator splitInto(OutputIterator output, const std::string_view source, const char separator, const size_t maxSplits)
+{
+    const auto view = splitView(source, separator, maxSplits);
+    return std::copy(view.begin(), view.end(), output);
+}
+
+[[nodiscard]] inline OwnedSplit splitOwned(const std::string_view source, const std::string_view separator, const size_t maxSplits)
+{ // counting is cheaper than splitting, so the block is sized by a count and only the fill splits
+    if (separator.size() == 1)
+    {
+        return splitOwned(source, separator[0], maxSplits);
+    }
+    return Detail::splitOwned<false>(source, Detail::StringSeparator{ separator, {} }, Detail::countSeparators(source, separator), maxSplits);
+}
+
+[[nodiscard]] inline OwnedSplit splitOwned(const std::string_view source, const char separator, const size_t maxSplits)
+{
+    return Detail::splitOwned<false>(source, Detail::CharSeparator{ separator }, Detail::count(source.data(), source.size(), separator), maxSplits);
+}
+
+[[nodiscard]] inline OwnedSplit splitSkipEmptyOwned(const std::string_view source, const std::string_view separator, const size_t maxSplits)
+{
+    if (separator.size() == 1)
+    {
+        return splitSkipEmptyOwned(source, separator[0], maxSplits);
+    }
+    return Detail::splitOwned<true>(source, Detail::StringSeparator{ separator, {} }, Detail::countSeparators(source, separator), maxSplits);
+}
+
+[[nodiscard]] inline OwnedSplit splitSkipEmptyOwned(const std::string_view source, const char separator, const size_t maxSplits)
+{
+    return Detail::splitOwned<true>(source, Detail::CharSeparator{ separator }, Detail::count(source.data(), source.size(), separator), maxSplits);
+}
+
+[[nodiscard]] inline OwnedSplit splitAnyOfOwned(const std::string_view source, const std::string_view separators, const size_t maxSplits)
+{
+    return splitAnyOfOwned(source, CharSet(separators), maxSplits);
+}
+
+[[nodiscard]] inline OwnedSplit splitAnyOfOwned(const std::string_view source, const CharSet& separators, const size_t maxSplits)
+{
+    return Detail::splitOwned<false>(source, Detail::CharSetSeparator<false>{ separators }, Detail::countAnyOf(source.data(), source.size(), separators), maxSplits);
+}
+
+[[nodiscard]] inline OwnedSplit splitAnyButOwned(const std::string_view source, const std::string_view separators, const size_t maxSplits)
+{
+    return splitAnyButOwned(source, CharSet(separators), maxSplits);
+}
+
+[[nodiscard]] inline OwnedSplit splitAnyButOwned(const std::string_view source, const CharSet& separators, const size_t maxSplits)
+{
+    const size_t separatorCount = source.size() - Detail::countAnyOf(source.data(), source.size(), separators);
+    return Detail::splitOwned<false>(source, Detail::CharSetSeparator<true>{ separators }, separatorCount, maxSplits);
+}
+
+[[nodiscard]] inline OwnedSplit splitAnyOfSkipEmptyOwned(const std::string_view source, const std::string_view separators, const size_t maxSplits)
+{
+    return splitAnyOfSkipEmptyOwned(source, CharSet(separators), maxSplits);
+}
+
+[[nodiscard]] inline OwnedSplit splitAnyOfSkipEmptyOwned(const std::string_view source, const CharSet& separators, const size_t maxSplits)
+{
+    return Detail::splitOwned<true>(source, Detail::CharSetSeparator<false>{ separators }, Detail::countAnyOf(source.data(), source.size(), separators), maxSplits);
+}
+
+[[nodiscard]] inline OwnedSplit splitAnyButSkipEmptyOwned(const std::string_view source, const std::string_view separators, const size_t maxSplits)
+{
+    return splitAnyButSkipEmptyOwned(source, CharSet(separators), maxSplits);
+}
+
+[[nodiscard]] inline OwnedSplit splitAnyButSkipEmptyOwned(const std::string_view source, const CharSet& separators, const size_t maxSplits)
+{
+    const size_t separatorCount = source.size() - Detail::countAnyOf(source.data(), source.size(), separators);
+    return Detail::splitOwned<true>(source, Detail::CharSetSeparator<true>{ separators }, separatorCount, maxSplits);
+}
+
+inline void splitInto(TokenIndex& tokens, const std::string_view source, const std::string_view separator, const size_t maxSplits)
+{
+    tokens.assign(source, separator, maxSplits);
+}
+
+inline void splitInto(TokenIndex& tokens, const std::string_view source, const char separator, const size_t maxSplits)
+{
+    tokens.assign(source, separator, maxSplits);
+}
+
+inline void splitAnyOfInto(std::vector<std::string_view>& parts, const std::string_view source, const std::string_view separators, const size_t maxSplits)
+{
+    parts.clear();
+    splitAnyOfInto(std::back_inserter(parts), source, separators, maxSplits);
+}
+
+template<class OutputIterator>
+inline OutputIterator splitAnyOfInto(OutputIterator output, const std::string_view source, const std::string_view separators, const size_t maxSplits)
+{
+    const auto view = splitAnyOfView(source, separators, maxSplits);
+    return std::copy(view.begin(), view.end(), output);
+}
+
+inline void splitAnyOfInto(std::vector<std::string_view>& parts, const std::string_view source, const CharSet& separators, const size_t maxSplits)
+{
+    parts.clear();
+    splitAnyOfInto(std::back_inserter(parts), source, separators, maxSplits);
+}
+
+template<class OutputIterator>
+inline OutputIterator splitAnyOfInto(OutputIterator output, const std::string_view source, const CharSet& separators, const size_t maxSplits)
+{
+    const auto view = splitAnyOfView(source, separators, maxSplits);
+    return std::copy(view.begin(), view.end(), output);
+}
+
+inline void splitAnyButInto(std::vector<std::string_view>& parts, const std::string_view source, const std::string_view separators, const size_t maxSplits)
+{
+    parts.clear();
+    splitAnyButInto(std::back_inserter(parts), source, separators, maxSplits);
+}
+
+template<class OutputIterator>
+inline OutputIterator splitAnyButInto(OutputIterator output, const std::string_view source, const std::string_view separators, const size_t maxSplits)
+{
+    const auto view = splitAnyButView(source, separators, maxSplits);
+    return std::copy(view.begin(), view.end(), output);
+}
+
+inline void splitAnyButInto(std::vector<std::string_view>& parts, const std::string_view source, const CharSet& separators, const size_t maxSplits)
+{
+    parts.clear();
+    splitAnyButInto(std::back_inserter(parts), source, separators, maxSplits);
+}
+
+template<class OutputIterator>
+inline OutputIterator splitAnyButInto(OutputIterator output, const std::string_view source, const CharSet& separators, const size_t maxSplits)
+{
+    const auto view = splitAnyButView(source, separators, maxSplits);
+    return std::copy(view.begin(), view.end(), output);
+}
+
+inline void splitSkipEmptyInto(std::vector<std::string_view>& parts, const std::string_view source, const std::string_view separator, const size_t maxSplits)
+{
+    parts.clear();
+    splitSkipEmptyInto(std::back_inserter(parts), source, separator, maxSplits);
+}
+
+template<class OutputIterator>
+inline OutputIterator splitSkipEmptyInto(OutputIterator output, const std::string_view source, const std::string_view separator, const size_t maxSplits)
+{
+    const auto view = splitSkipEmptyView(source, separator, maxSplits);
+    return std::copy(view.begin(), view.end(), output);
+}
+
+inline void splitSkipEmptyInto(std::vector<std::string_view>& parts, const std::string_view source, const char separator, const size_t maxSplits)
+{
+    parts.clear();
+    splitSkipEmptyInto(std::back_inserter(parts), source, separator, maxSplits);
+}
+
+template<class OutputIterator>
+inline OutputIterator splitSkipEmptyInto(OutputIterator output, const std::string_view source, const char separator, const size_t maxSplits)
+{
+    const auto view = splitSkipEmptyView(source, separator, maxSplits);
+    return std::copy(view.begin(), view.end(), output);
+}
+
+inline void splitAnyOfSkipEmptyInto(std::vector<std::string_view>& parts, const std::string_view source, const std::string_view separators, const size_t maxSplits)
+{
+    parts.clear();
+    splitAnyOfSkipEmptyInto(std::back_inserter(parts), source, separators, maxSplits);
+}
+
+template<class OutputIterator>
+inline OutputIterator splitAnyOfSkipEmptyInto(OutputIterator output, const std::string_view source, const std::string_view separators, const size_t maxSplits)
+{
+    const auto view = splitAnyOfSkipEmptyView(source, separators, maxSplits);
+    return std::copy(view.begin(), view.end(), output);
+}
+
+inline void splitAnyOfSkipEmptyInto(std::vector<std::string_view>& parts, const std::string_view source, const CharSet& separators, const size_t maxSplits)
+{
+    parts.clear();
+    splitAnyOfSkipEmptyInto(std::back_inserter(parts), source, separators, maxSplits);
+}
+
+template<class OutputIterator>
+inline OutputIterator splitAnyOfSkipEmptyInto(OutputIterator output, const std::string_view source, const CharSet& separators, const size_t maxSplits)
+{
+    const auto view = splitAnyOfSkipEmptyView(source, separators, maxSplits);
+    return std::copy(view.begin(), view.end(), output);
+}
+
+inline void splitAnyButSkipEmptyInto(std::vector<std::string_view>& parts, const std::string_view source, const std::string_view separators, const size_t maxSplits)
+{
+    parts.clear();
+    splitAnyButSkipEmptyInto(std::back_inserter(parts), source, separators, maxSplits);
+}
+
+template<class OutputIterator>
+inline OutputIterator splitAnyButSkipEmptyInto(OutputIterator output, const std::string_view source, const std::string_view separators, const size_t maxSplits)
+{
+    const auto view = splitAnyButSkipEmptyView(source, separators, maxSplits);
+    return std::copy(view.begin(), view.end(), output);
+}
+
+inline void splitAnyButSkipEmptyInto(std::vector<std::string_view>& parts, const std::string_view source, const CharSet& separators, const size_t maxSplits)
+{
+    parts.clear();
+    splitAnyButSkipEmptyInto(std::back_inserter(parts), source, separators, maxSplits);
+}
+
+template<class OutputIterator>
+inline OutputIterator splitAnyButSkipEmptyInto(OutputIterator output, const std::string_view source, const CharSet& separators, const size_t maxSplits)
+{
+    const auto view = splitAnyButSkipEmptyView(source, separators, maxSplits);
+    return std::copy(view.begin(), view.end(), output);
+}
+
+
+[[nodiscard]] inline std::vector<std::string_view> splitQuoted(const std::string_view source, const char separator, const char quoteChar, const char escapeChar)
+{
+    return Detail::splitQuoted(source, separator, quoteChar, escapeChar);
+}
+
+[[nodiscard]] inline std::vector<std::string_view> splitQuotedUnescaped(const std::string_view source, std::string& buffer, const char separator, const char quoteChar, const char escapeChar)
+{
+    return Detail::splitQuotedUnescaped(source, buffer, separator, quoteChar, escapeChar);
+}
+
+template<typename... Types>
+[[nodiscard]] inline std::optional<std::tuple<Types...>> splitAs(const std::string_view source, const char separator)
+{
+    return Detail::splitAs<Types...>(source, Detail::CharSeparator{separator}, std::index_sequence_for<Types...>());
+}
+
+template<typename... Types>
+[[nodiscard]] inline std::optional<std::tuple<Types...>> splitAs(const std::string_view source, const std::string_view separator)
+{
+    return Detail::splitAs<Types...>(source, Detail::StringSeparator{ separator, {} }, std::index_sequence_for<Types...>());
+}
+
+
+[[nodiscard]] constexpr KeyValueView parseKeyValue(const std::string_view source, const char pairSeparator, const char keyValueSeparator, const bool stripWhitespace) noexcept
+{
+    return KeyValueView(source, Detail::KeyValueParser(pairSeparator, keyValueSeparator, stripWhitespace, CharSets::whitespace));
+}
+
+inline void parseKeyValueInto(std::vector<KeyValue>& pairs, const std::string_view source, const char pairSeparator, const char keyValueSeparator, const bool stripWhitespace)
+{
+    pairs.clear();
+    auto emit = [&pairs](const KeyValue& pair, size_t) {
+        pairs.push_back(pair);
+        return true;
+    };
+    Detail::KeyValueParser(pairSeparator, keyValueSeparator, stripWhitespace, CharSets::whitespace).forEachPair(source, 0, emit);
+}
+
+
 //#######################################################################################
 //
 //                                  Find
@@ -238,7 +656,7 @@ template<size_t maxSplits>
 
 [[nodiscard]] constexpr size_t find(const std::string_view hayStack, const std::string_view needle, const size_t startIndex) noexcept
 {
-    return hayStack.find(needle, startIndex);
+    return Detail::find(hayStack.data(), hayStack.size(), startIndex, needle.data(), needle.size());
 }
 
 [[nodiscard]] constexpr size_t find(const std::string_view hayStack, const char needle, const size_t startIndex) noexcept
@@ -248,12 +666,52 @@ template<size_t maxSplits>
 
 [[nodiscard]] constexpr size_t findAnyOf(const std::string_view hayStack, const std::string_view needles, const size_t startIndex) noexcept
 {
-    return hayStack.find_first_of(needles, startIndex);
+    return Detail::findAnyOf(hayStack.data(), hayStack.size(), startIndex, needles.data(), needles.size());
 }
 
 [[nodiscard]] constexpr size_t findAnyBut(const std::string_view hayStack, const std::string_view needles, const size_t startIndex) noexcept
 {
-    return hayStack.find_first_not_of(needles, startIndex);
+    return Detail::findAnyBut(hayStack.data(), hayStack.size(), startIndex, needles.data(), needles.size());
+}
+
+[[nodiscard]] constexpr size_t findAnyOf(const std::string_view hayStack, const CharSet& needles, const size_t startIndex) noexcept
+{
+    return Detail::findAnyOf(hayStack.data(), hayStack.size(), startIndex, needles);
+}
+
+[[nodiscard]] constexpr size_t findAnyBut(const std::string_view hayStack, const CharSet& needles, const size_t startIndex) noexcept
+{
+    return Detail::findAnyBut(hayStack.data(), hayStack.size(), startIndex, needles);
+}
+
+[[nodiscard]] constexpr size_t rFind(const std::string_view hayStack, const std::string_view needle, const size_t startIndex) noexcept
+{
+    return Detail::rFind(hayStack.data(), hayStack.size(), startIndex, needle.data(), needle.size());
+}
+
+[[nodiscard]] constexpr size_t rFind(const std::string_view hayStack, const char needle, const size_t startIndex) noexcept
+{
+    return Detail::rFind(hayStack.data(), hayStack.size(), startIndex, needle);
+}
+
+[[nodiscard]] constexpr size_t rFindAnyOf(const std::string_view hayStack, const std::string_view needles, const size_t startIndex) noexcept
+{
+    return Detail::rFindAnyOf(hayStack.data(), hayStack.size(), startIndex, needles.data(), needles.size());
+}
+
+[[nodiscard]] constexpr size_t rFindAnyBut(const std::string_view hayStack, const std::string_view needles, const size_t startIndex) noexcept
+{
+    return Detail::rFindAnyBut(hayStack.data(), hayStack.size(), startIndex, needles.data(), needles.size());
+}
+
+[[nodiscard]] constexpr size_t rFindAnyOf(const std::string_view hayStack, const CharSet& needles, const size_t startIndex) noexcept
+{
+    return Detail::rFindAnyOf(hayStack.data(), hayStack.size(), startIndex, needles);
+}
+
+[[nodiscard]] constexpr size_t rFindAnyBut(const std::string_view hayStack, const CharSet& needles, const size_t startIndex) noexcept
+{
+    return Detail::rFindAnyBut(hayStack.data(), hayStack.size(), startIndex, needles);
 }
 
 //#######################################################################################
@@ -282,6 +740,26 @@ template<size_t maxSplits>
     return Detail::iFindAnyBut(hayStack.data(), hayStack.size(), startIndex, needles.data(), needles.size());
 }
 
+[[nodiscard]] constexpr size_t irFind(const std::string_view hayStack, const std::string_view needle, const size_t startIndex) noexcept
+{
+    return Detail::irFind(hayStack.data(), hayStack.size(), startIndex, needle.data(), needle.size());
+}
+
+[[nodiscard]] constexpr size_t irFind(const std::string_view hayStack, const char needle, const size_t startIndex) noexcept
+{
+    return Detail::irFind(hayStack.data(), hayStack.size(), startIndex, needle);
+}
+
+[[nodiscard]] constexpr size_t irFindAnyOf(const std::string_view hayStack, const std::string_view needles, const size_t startIndex) noexcept
+{
+    return Detail::irFindAnyOf(hayStack.data(), hayStack.size(), startIndex, needles.data(), needles.size());
+}
+
+[[nodiscard]] constexpr size_t irFindAnyBut(const std::string_view hayStack, const std::string_view needles, const size_t startIndex) noexcept
+{
+    return Detail::irFindAnyBut(hayStack.data(), hayStack.size(), startIndex, needles.data(), needles.size());
+}
+
 
 //#######################################################################################
 //
@@ -310,6 +788,39 @@ template<size_t maxSplits>
     return findAnyBut(hayStack, needles, 0) == INDEX_NOT_FOUND;
 }
 
+[[nodiscard]] constexpr bool containsAnyOf(const std::string_view hayStack, const CharSet& needles) noexcept
+{
+    return findAnyOf(hayStack, needles, 0) != INDEX_NOT_FOUND;
+}
+
+[[nodiscard]] constexpr bool containsNoneOf(const std::string_view hayStack, const CharSet& needles) noexcept
+{
+    return findAnyOf(hayStack, needles, 0) == INDEX_NOT_FOUND;
+}
+
+[[nodiscard]] constexpr bool containsOnly(const std::string_view hayStack, const CharSet& needles) noexcept
+{
+    return findAnyBut(hayStack, needles, 0) == INDEX_NOT_FOUND;
+}
+
+template<bool ignoreCase>
+[[nodiscard]] inline size_t findAnyOf(const std::string_view hayStack, const BasicMultiSearcher<ignoreCase>& needles, const size_t startIndex) noexcept
+{
+    return needles.find(hayStack, startIndex).position;
+}
+
+template<bool ignoreCase>
+[[nodiscard]] inline bool containsAnyOf(const std::string_view hayStack, const BasicMultiSearcher<ignoreCase>& needles) noexcept
+{
+    return needles.contains(hayStack);
+}
+
+template<bool ignoreCase>
+[[nodiscard]] inline bool containsNoneOf(const std::string_view hayStack, const BasicMultiSearcher<ignoreCase>& needles) noexcept
+{
+    return !needles.contains(hayStack);
+}
+
 //#######################################################################################
 //
 //                               Contains case insensitive
@@ -337,6 +848,60 @@ template<size_t maxSplits>
     return iFindAnyBut(hayStack, needles, 0) == INDEX_NOT_FOUND;
 }
 
+//#######################################################################################
+//
+//                                      Count
+//
+//#######################################################################################
+
+
+[[nodiscard]] constexpr size_t count(const std::string_view hayStack, const char needle) noexcept
+{
+    return Detail::count(hayStack.data(), hayStack.size(), needle);
+}
+
+[[nodiscard]] constexpr size_t count(const std::string_view hayStack, const std::string_view needle) noexcept
+{
+    return Detail::count(hayStack.data(), hayStack.size(), needle.data(), needle.size());
+}
+
+[[nodiscard]] constexpr size_t countAnyOf(const std::string_view hayStack, const std::string_view needles) noexcept
+{
+    return Detail::countAnyOf(hayStack.data(), hayStack.size(), CharSet(needles));
+}
+
+[[nodiscard]] constexpr size_t countAnyOf(const std::string_view hayStack, const CharSet& needles) noexcept
+{
+    return Detail::countAnyOf(hayStack.data(), hayStack.size(), needles);
+}
+
+template<class OutputIterator>
+inline OutputIterator findAll(const std::string_view hayStack, const char needle, OutputIterator output)
+{
+    return Detail::findAll(hayStack.data(), hayStack.size(), needle, output);
+}
+
+template<class OutputIterator>
+inline OutputIterator findAll(const std::string_view hayStack, const std::string_view needle, OutputIterator output)
+{
+    return Detail::findAll(hayStack.data(), hayStack.size(), needle.data(), needle.size(), output);
+}
+
+[[nodiscard]] inline std::vector<size_t> findAll(const std::string_view hayStack, const char needle)
+{
+    std::vector<size_t> positions;
+    findAll(hayStack, needle, std::back_inserter(positions));
+    return positions;
+}
+
+[[nodiscard]] inline std::vector<size_t> findAll(const std::string_view hayStack, const std::string_view needle)
+{
+    std::vector<size_t> positions;
+    findAll(hayStack, needle, std::back_inserter(positions));
+    return positions;
+}
+
+
 //#######################################################################################
 //
 //                                      EndsWith
@@ -462,6 +1027,126 @@ template<size_t maxSplits>
 }
 
 
+//#######################################################################################
+//
+//                                      Hash
+//
+//#######################################################################################
+
+
+[[nodiscard]] constexpr uint64_t hash64(const std::string_view str, const uint64_t seed) noexcept
+{
+    return Detail::hash<false>(str.data(), str.size(), seed);
+}
+
+[[nodiscard]] constexpr uint64_t iHash64(const std::string_view str, const uint64_t seed) noexcept
+{
+    return Detail::hash<true>(str.data(), str.size(), seed);
+}
+
+[[nodiscard]] constexpr Hash128 hash128(const std::string_view str, const uint64_t seed) noexcept
+{
+    return Detail::hash128<false>(str.data(), str.size(), seed);
+}
+
+[[nodiscard]] constexpr Hash128 iHash128(const std::string_view str, const uint64_t seed) noexcept
+{
+    return Detail::hash128<true>(str.data(), str.size(), seed);
+}
+
+
+//#######################################################################################
+//
+//                                      Batch
+//
+//#######################################################################################
+
+
+inline void containsBatch(const std::string_view* const hayStacks, const size_t count, const std::string_view needle, uint64_t* const matches, const size_t threadCount)
+{
+    const Searcher searcher(needle);
+    Detail::batch(hayStacks, count, matches, threadCount, [&searcher](const std::string_view hayStack) { return searcher.contains(hayStack); });
+}
+
+inline void iContainsBatch(const std::string_view* const hayStacks, const size_t count, const std::string_view needle, uint64_t* const matches, const size_t threadCount)
+{
+    const ISearcher searcher(needle);
+    Detail::batch(hayStacks, count, matches, threadCount, [&searcher](const std::string_view hayStack) { return searcher.contains(hayStack); });
+}
+
+inline void startsWithBatch(const std::string_view* const hayStacks, const size_t count, const std::string_view prefix, uint64_t* const matches, const size_t threadCount)
+{
+    Detail::batch(hayStacks, count, matches, threadCount, [prefix](const std::string_view hayStack) { return startsWith(hayStack, prefix); });
+}
+
+inline void iStartsWithBatch(const std::string_view* const hayStacks, const size_t count, const std::string_view prefix, uint64_t* const matches, const size_t threadCount)
+{
+    Detail::batch(hayStacks, count, matches, threadCount, [prefix](const std::string_view hayStack) { return iStartsWith(hayStack, prefix); });
+}
+
+inline void endsWithBatch(const std::string_view* const hayStacks, const size_t count, const std::string_view suffix, uint64_t* const matches, const size_t threadCount)
+{
+    Detail::batch(hayStacks, count, matches, threadCount, [suffix](const std::string_view hayStack) { return endsWith(hayStack, suffix); });
+}
+
+inline void iEndsWithBatch(const std::string_view* const hayStacks, const size_t count, const std::string_view suffix, uint64_t* const matches, const size_t threadCount)
+{
+    Detail::batch(hayStacks, count, matches, threadCount, [suffix](const std::string_view hayStack) { return iEndsWith(hayStack, suffix); });
+}
+
+[[nodiscard]] inline std::vector<uint64_t> containsBatch(const std::vector<std::string_view>& hayStacks, const std::string_view needle, const size_t threadCount)
+{
+    std::vector<uint64_t> matches((hayStacks.size() + 63) / 64);
+    containsBatch(hayStacks.data(), hayStacks.size(), needle, matches.data(), threadCount);
+    return matches;
+}
+
+[[nodiscard]] inline std::vector<uint64_t> iContainsBatch(const std::vector<std::string_view>& hayStacks, const std::string_view needle, const size_t threadCount)
+{
+    std::vector<uint64_t> matches((hayStacks.size() + 63) / 64);
+    iContainsBatch(hayStacks.data(), hayStacks.size(), needle, matches.data(), threadCount);
+    return matches;
+}
+
+[[nodiscard]] inline std::vector<uint64_t> startsWithBatch(const std::vector<std::string_view>& hayStacks, const std::string_view prefix, const size_t threadCount)
+{
+    std::vector<uint64_t> matches((hayStacks.size() + 63) / 64);
+    startsWithBatch(hayStacks.data(), hayStacks.size(), prefix, matches.data(), threadCount);
+    return matches;
+}
+
+[[nodiscard]] inline std::vector<uint64_t> iStartsWithBatch(const std::vector<std::string_view>& hayStacks, const std::string_view prefix, const size_t threadCount)
+{
+    std::vector<uint64_t> matches((hayStacks.size() + 63) / 64);
+    iStartsWithBatch(hayStacks.data(), hayStacks.size(), prefix, matches.data(), threadCount);
+    return matches;
+}
+
+[[nodiscard]] inline std::vector<uint64_t> endsWithBatch(const std::vector<std::string_view>& hayStacks, const std::string_view suffix, const size_t threadCount)
+{
+    std::vector<uint64_t> matches((hayStacks.size() + 63) / 64);
+    endsWithBatch(hayStacks.data(), hayStacks.size(), suffix, matches.data(), threadCount);
+    return matches;
+}
+
+[[nodiscard]] inline std::vector<uint64_t> iEndsWithBatch(const std::vector<std::string_view>& hayStacks, const std::string_view suffix, const size_t threadCount)
+{
+    std::vector<uint64_t> matches((hayStacks.size() + 63) / 64);
+    iEndsWithBatch(hayStacks.data(), hayStacks.size(), suffix, matches.data(), threadCount);
+    return matches;
+}
+
+[[nodiscard]] inline std::vector<std::string_view> parallelSplit(const std::string_view source, const char separator, const size_t threadCount, const ParallelSchedule schedule)
+{
+    return Detail::parallelSplit(source, separator, std::string_view(&separator, 1), threadCount, schedule);
+}
+
+[[nodiscard]] inline std::vector<std::string_view> parallelSplit(const std::string_view source, const std::string_view separator, const size_t threadCount, const ParallelSchedule schedule)
+{
+    return Detail::parallelSplit(source, separator, separator, threadCount, schedule);
+}
+
+
 //#######################################################################################
 //
 //                                      toString
@@ -482,29 +1167,43 @@ template<typename T>
 //#######################################################################################
 
 
-[[nodiscard]] constexpr inline std::string_view stripEnd(std::string_view str, std::string_view stripChars) noexcept
+[[nodiscard]] constexpr inline std::string_view stripEnd(std::string_view str, const CharSet& stripChars) noexcept
 {
-    const size_t end = str.find_last_not_of(stripChars) + 1;
+    const size_t end = Detail::rFindAnyBut(str.data(), str.size(), INDEX_NOT_FOUND, stripChars) + 1;
     str.remove_suffix(str.size() - end);
     return str;
 }
 
 
-[[nodiscard]] constexpr inline std::string_view stripStart(std::string_view str, std::string_view stripChars) noexcept
+[[nodiscard]] constexpr inline std::string_view stripStart(std::string_view str, const CharSet& stripChars) noexcept
 {
-    const size_t start = str.find_first_not_of(stripChars);
+    const size_t start = Detail::findAnyBut(str.data(), str.size(), 0, stripChars);
     str.remove_prefix(std::min(str.size(), start));
     return str;
 }
 
 
+[[nodiscard]] constexpr inline std::string_view strip(std::string_view str, const CharSet& stripChars) noexcept
+{
+    return stripEnd(stripStart(str, stripChars), stripChars);
+}
+
+
+[[nodiscard]] constexpr inline std::string_view stripEnd(std::string_view str, std::string_view stripChars) noexcept
+{
+    return stripEnd(str, CharSet(stripChars));
+}
+
+
+[[nodiscard]] constexpr inline std::string_view stripStart(std::string_view str, std::string_view stripChars) noexcept
+{
+    return stripStart(str, CharSet(stripChars));
+}
+
+
 [[nodiscard]] constexpr inline std::string_view strip(std::string_view str, std::string_view stripChars) noexcept
 {
-    const size_t start = str.find_first_not_of(stripChars);
-    str.remove_prefix(std::min(str.size(), start));
-    const size_t end = str.find_last_not_of(stripChars) + 1;
-    str.remove_suffix(str.size() - end);
-    return str;
+    return strip(str, CharSet(stripChars));
 }
 
 
@@ -517,28 +1216,19 @@ template<typename T>
 
 [[nodiscard]] constexpr inline std::string_view iStripEnd(std::string_view str, std::string_view stripChars) noexcept
 {
-    const size_t end = Detail::irFindAnyBut(str.data(), str.size(), 0, stripChars.data(), stripChars.size()) + 1;
-    return str.substr(0, end);
+    return stripEnd(str, CharSet().iAdd(stripChars));
 }
 
 
 [[nodiscard]] constexpr inline std::string_view iStripStart(std::string_view str, std::string_view stripChars) noexcept
 {
-    const size_t start = Detail::iFindAnyBut(str.data(), str.size(), 0, stripChars.data(), stripChars.size());
-    str.remove_prefix(std::min(str.size(), start));
-    return str;
+    return stripStart(str, CharSet().iAdd(stripChars));
 }
 
 
 [[nodiscard]] constexpr inline std::string_view iStrip(std::string_view str, std::string_view stripChars) noexcept
 {
-    const size_t start = Detail::iFindAnyBut(str.data(), str.size(), 0, stripChars.data(), stripChars.size());
-    str.remove_prefix(std::min(str.size(), start));
-
-    const size_t end = Detail::irFindAnyBut(str.data(), str.size(), 0, stripChars.data(), stripChars.size()) + 1;
-    str.remove_suffix(str.size() - end);
-
-    return str;
+    return strip(str, CharSet().iAdd(stripChars));
 }
 
 
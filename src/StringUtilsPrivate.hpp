@@ -73,18 +73,50 @@ static_assert(_MSC_VER >= 1915, "MSVC is not supported for versions below 19.15"
 
 #include <string>
 #include <cstring>
+#include <cstdint>
 #include <type_traits>
 #include <array>
+#include <algorithm>
+#include <iterator>
 #include <vector>
+#include <memory>
+#include <utility>
 
 
 #ifndef STRINGUTILS_NO_STRINGSTREAM
 #    include <sstream>
 #endif
 
+#ifndef STRINGUTILS_NO_THREADS
+#    include <thread>
+#    include <atomic>
+#endif
+
+#if defined(STRINGUTILS_MSVC_COMPILER) && defined(_M_X64)
+#    include <intrin.h>
+#endif
+
+// MappedFile needs the posix mmap api, define STRINGUTILS_NO_MMAP to leave it out
+#if !defined(STRINGUTILS_NO_MMAP) && (defined(__linux__) || defined(__APPLE__) || defined(__unix__))
+#    define STRINGUTILS_HAS_MMAP 1
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#else
+#    define STRINGUTILS_HAS_MMAP 0
+#endif
+
 #if STRINGUTILS_HAS_CXX17
 #    include <string_view>
 #    include <optional>
+#    include <tuple>
+#    include <charconv>
+#    include <cstdlib>
+#endif
+
+#if STRINGUTILS_HAS_CXX20
+#    include <ranges>
 #endif
 
 
@@ -95,8 +127,47 @@ static_assert(_MSC_VER >= 1915, "MSVC is not supported for versions below 19.15"
 
 #endif
 
+
+// The simd kernels can only be used inside of constexpr functions if we can tell whether we are evaluated at compile time
+#if defined(STRINGUTILS_HAS_IS_CONSTANT_EVALUATED)
+#elif STRINGUTILS_HAS_CXX20
+#    define STRINGUTILS_HAS_IS_CONSTANT_EVALUATED 1
+#elif defined(STRINGUTILS_GNU_COMPILER) && __GNUC__ >= 9
+#    define STRINGUTILS_HAS_IS_CONSTANT_EVALUATED 1
+#elif defined(STRINGUTILS_CLANG_COMPILER) && __clang_major__ >= 9
+#    define STRINGUTILS_HAS_IS_CONSTANT_EVALUATED 1
+#elif defined(STRINGUTILS_MSVC_COMPILER) && _MSC_VER >= 1925
+#    define STRINGUTILS_HAS_IS_CONSTANT_EVALUATED 1
+#else
+#    define STRINGUTILS_HAS_IS_CONSTANT_EVALUATED 0
+#endif
+
 using uchar = unsigned char;
 
+namespace STRINGUTILS_NAMESPACE {
+namespace Detail {
+/**
+* Returns true if called during constant evaluation, used to pick the scalar implementation for constexpr calls
+* Always returns true if the compiler can not tell, then the simd kernels are disabled
+*/
+constexpr inline bool isConstantEvaluated() noexcept
+{
+#if STRINGUTILS_HAS_IS_CONSTANT_EVALUATED && STRINGUTILS_HAS_CXX20
+    return std::is_constant_evaluated();
+#elif STRINGUTILS_HAS_IS_CONSTANT_EVALUATED
+    return __builtin_is_constant_evaluated();
+#else
+    return true;
+#endif
+}
+
+constexpr inline char charToLowerCase(char c) noexcept;
+constexpr inline bool iEquals(const char* ptr1, const char* ptr2, size_t size) noexcept;
+} // namespace Detail
+} // namespace STRINGUTILS_NAMESPACE
+
+#include "StringUtilsSimd.hpp"
+
 namespace STRINGUTILS_NAMESPACE {
 static constexpr size_t INDEX_NOT_FOUND{ std::string::npos };
 #if STRINGUTILS_HAS_CXX17
@@ -396,6 +467,12 @@ constexpr inline const char* findChar(const char* const hayStack, const size_t h
 */
 constexpr inline const char* rFindChar(const char* const hayStack, const size_t haySize, const char needle) noexcept
 {
+#if STRINGUTILS_HAS_SIMD
+    if (!isConstantEvaluated())
+    {
+        return Simd::Dispatch::rFindChar(hayStack, haySize, needle);
+    }
+#endif
     if (haySize != 0)
     {
         for (const char* position = hayStack + haySize - 1;; --position)
@@ -424,6 +501,12 @@ constexpr inline const char* rFindChar(const char* const hayStack, const size_t
 
 constexpr inline const char* iFindChar(const char* hayStack, const size_t haySize, const char needle) noexcept
 {
+#if STRINGUTILS_HAS_SIMD
+    if (!isConstantEvaluated())
+    {
+        return Simd::Dispatch::iFindChar(hayStack, haySize, needle);
+    }
+#endif
     const char* const end = hayStack + haySize;
     const char lower = charToLowerCase(needle);
     const char upper = charToUpperCase(needle);
@@ -445,6 +528,12 @@ constexpr inline const char* iFindChar(const char* hayStack, const size_t haySiz
 
 constexpr inline const char* irFindChar(const char* const hayStack, const size_t haySize, const char needle) noexcept
 {
+#if STRINGUTILS_HAS_SIMD
+    if (!isConstantEvaluated())
+    {
+        return Simd::Dispatch::irFindChar(hayStack, haySize, needle);
+    }
+#endif
     if (haySize != 0)
     {
         const char lower = charToLowerCase(needle);
@@ -475,158 +564,229 @@ constexpr inline bool equals(const char* const ptr1, const char* const ptr2, siz
 }
 
 
-constexpr inline bool iEquals(const char* ptr1, const char* ptr2, size_t size) noexcept
+/**
+* Index of the first char where [ptr1, ptr1 + size) and [ptr2, ptr2 + size) differ case insensitively, size if there is none
+*/
+constexpr inline size_t iMismatch(const char* const ptr1, const char* const ptr2, const size_t size) noexcept
 {
-    const char* end = ptr1 + size;
-    for (; ptr1 != end; ++ptr1, ++ptr2)
+#if STRINGUTILS_HAS_SIMD
+    if (!isConstantEvaluated())
+    {
+        return Simd::Dispatch::iMismatch(ptr1, ptr2, size);
+    }
+#endif
+    for (size_t position = 0; position != size; ++position)
     {
-        if (!charEqualsIgnoreCase(*ptr1, *ptr2))
+        if (!charEqualsIgnoreCase(ptr1[position], ptr2[position]))
         {
-            return false;
+            return position;
         }
     }
-    return true;
+    return size;
+}
+
+
+constexpr inline bool iEquals(const char* ptr1, const char* ptr2, size_t size) noexcept
+{
+    return iMismatch(ptr1, ptr2, size) == size;
+}
+
+
+/**
+* Three way compare of the lower case strings, chars are compared as unsigned like char_traits::compare
+*/
+constexpr inline int iCompare(const char* const ptr1, const size_t size1, const char* const ptr2, const size_t size2) noexcept
+{
+    const size_t size = std::min(size1, size2);
+    const size_t mismatch = iMismatch(ptr1, ptr2, size);
+    if (mismatch != size)
+    {
+        return (static_cast<uchar>(charToLowerCase(ptr1[mismatch])) < static_cast<uchar>(charToLowerCase(ptr2[mismatch]))) ? -1 : 1;
+    }
+    return (size1 < size2) ? -1 : ((size1 > size2) ? 1 : 0);
 }
 
 
-//TODO: benchmark 64 byte version (1 bit per char)
+} // namespace Detail
+
 
-class StringMatchHelper
-{ // helper for findAny so we do not have O(n) instead of O(n^2)
+class CharSet
+{
   private:
-    bool m_Marks[256] = {};
+    // c is in the set if bit ((c >> 4) & 7) of m_Bits[(c & 0x0F) | ((c >> 3) & 0x10)] is set,
+    // so m_Bits[0, 16) and m_Bits[16, 32) are directly the pshufb tables of the chars 0x00 - 0x7F and 0x80 - 0xFF
+    uint8_t m_Bits[32] = {};
 
   public:
-    constexpr void mark(const char c) noexcept
+    constexpr CharSet() noexcept = default;
+
+    constexpr explicit CharSet(const std::string_view chars) noexcept
     {
-        m_Marks[static_cast<uchar>(c)] = true;
+        add(chars);
     }
 
-    constexpr void iMark(const char c) noexcept
+    constexpr CharSet& add(const char c) noexcept
     {
-        mark(charToLowerCase(c));
-        mark(charToUpperCase(c));
+        const uchar u = static_cast<uchar>(c);
+        m_Bits[(u & 0x0F) | ((u >> 3) & 0x10)] |= static_cast<uint8_t>(1u << ((u >> 4) & 0x07));
+        return *this;
     }
 
-    constexpr void mark(const char* start, const char* const end) noexcept
+    constexpr CharSet& add(const std::string_view chars) noexcept
     {
-        for (; start != end; ++start)
+        for (const char c : chars)
         {
-            mark(*start);
+            add(c);
         }
+        return *this;
     }
 
-    constexpr void iMark(const char* start, const char* const end) noexcept
+    constexpr CharSet& addRange(const char first, const char last) noexcept
     {
-        for (; start != end; ++start)
+        for (unsigned c = static_cast<uchar>(first); c <= static_cast<uchar>(last); ++c)
         {
-            iMark(*start);
+            add(static_cast<char>(c));
         }
+        return *this;
     }
 
-    constexpr bool hasMatch(const char c) const noexcept
+    constexpr CharSet& iAdd(const char c) noexcept
     {
-        return m_Marks[static_cast<uchar>(c)];
+        add(Detail::charToLowerCase(c));
+        return add(Detail::charToUpperCase(c));
     }
-    constexpr bool hasMatch(const uchar c) const noexcept
+
+    constexpr CharSet& iAdd(const std::string_view chars) noexcept
     {
-        return m_Marks[c];
+        for (const char c : chars)
+        {
+            iAdd(c);
+        }
+        return *this;
     }
-};
 
-constexpr inline StringMatchHelper iGenerateStringMatchHelper(const char* const source, const size_t sourceSize) noexcept
-{
-    StringMatchHelper matchHelper;
-    matchHelper.iMark(source, source + sourceSize);
-    return matchHelper;
-}
+    [[nodiscard]] constexpr bool contains(const char c) const noexcept
+    {
+        const uchar u = static_cast<uchar>(c);
+        return (m_Bits[(u & 0x0F) | ((u >> 3) & 0x10)] >> ((u >> 4) & 0x07)) & 1;
+    }
 
+    [[nodiscard]] constexpr bool empty() const noexcept
+    {
+        for (const uint8_t bits : m_Bits)
+        {
+            if (bits != 0)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
 
-constexpr inline StringMatchHelper generateStringMatchHelper(const char* const source, const size_t sourceSize) noexcept
-{
-    StringMatchHelper matchHelper;
-    matchHelper.mark(source, source + sourceSize);
-    return matchHelper;
-}
+    [[nodiscard]] constexpr CharSet operator~() const noexcept
+    {
+        CharSet result;
+        for (size_t i = 0; i < 32; ++i)
+        {
+            result.m_Bits[i] = static_cast<uint8_t>(~m_Bits[i]);
+        }
+        return result;
+    }
 
+    [[nodiscard]] constexpr CharSet operator|(const CharSet& other) const noexcept
+    {
+        CharSet result;
+        for (size_t i = 0; i < 32; ++i)
+        {
+            result.m_Bits[i] = m_Bits[i] | other.m_Bits[i];
+        }
+        return result;
+    }
 
-constexpr inline size_t find(const char* hayStack, const size_t haySize, const size_t startIndex, char needle) noexcept
-{
-    if (startIndex < haySize)
+    [[nodiscard]] constexpr CharSet operator&(const CharSet& other) const noexcept
     {
-        const char* match = findChar(hayStack + startIndex, haySize + 1 - startIndex, needle);
-        if (match != nullptr)
+        CharSet result;
+        for (size_t i = 0; i < 32; ++i)
         {
-            return static_cast<size_t>(match - hayStack);
+            result.m_Bits[i] = m_Bits[i] & other.m_Bits[i];
         }
+        return result;
     }
-    return INDEX_NOT_FOUND;
-}
 
+    /**
+    * The 32 byte table used by the simd kernels
+    */
+    [[nodiscard]] constexpr const uint8_t* data() const noexcept
+    {
+        return m_Bits;
+    }
+};
 
-constexpr inline size_t find(const char* hayStack, const size_t haySize, const size_t startIndex, const char* needle, const size_t needleSize) noexcept
+struct ILess
 {
-    if (needleSize > haySize || startIndex > haySize - needleSize)
+    using is_transparent = void;
+
+    [[nodiscard]] constexpr bool operator()(const std::string_view str1, const std::string_view str2) const noexcept
     {
-        return INDEX_NOT_FOUND;
+        return Detail::iCompare(str1.data(), str1.size(), str2.data(), str2.size()) < 0;
     }
+};
 
-    if (needleSize == 0)
+struct IGreater
+{
+    using is_transparent = void;
+
+    [[nodiscard]] constexpr bool operator()(const std::string_view str1, const std::string_view str2) const noexcept
     {
-        return startIndex;
+        return Detail::iCompare(str1.data(), str1.size(), str2.data(), str2.size()) > 0;
     }
+};
 
-    const char* const end = hayStack + (haySize + 1 - needleSize);
-    for (const char* position = hayStack + startIndex;; ++position)
-    {
-        position = findChar(position, static_cast<size_t>(end - position), *needle); // Searches for the first character of needle
-        if (position == nullptr)
-        {
-            return INDEX_NOT_FOUND;
-        }
 
-        if (equals(position, needle, needleSize)) // found match
-        {
-            return static_cast<size_t>(position - hayStack);
-        }
-    }
+
+namespace Detail {
+
+#if STRINGUTILS_HAS_SIMD_CLASSIFY
+/**
+* Index of the first char in [hayStack + startIndex, hayStack + haySize) that is in chars (not in chars if negate is set)
+* Requires startIndex < haySize
+*/
+template<bool negate>
+inline size_t findCharClass(const char* const hayStack, const size_t haySize, const size_t startIndex, const CharSet& chars) noexcept
+{
+    const char* const match = Simd::Dispatch::findCharClass<negate>(hayStack + startIndex, haySize - startIndex, chars.data());
+    return (match != nullptr) ? static_cast<size_t>(match - hayStack) : INDEX_NOT_FOUND;
 }
 
 /**
-* Implementation of string_view::find_first_of (MSVC implementation)
-* Keep around for C++11 compatibility
+* Index of the last char in [hayStack, hayStack + startIndex] that is in chars (not in chars if negate is set)
+* Requires startIndex < haySize
 */
-constexpr size_t findAnyOf(const char* const hayStack, const size_t haySize, const size_t startIndex, const char* const needles, const size_t needlesSize) noexcept
+template<bool negate>
+inline size_t rFindCharClass(const char* const hayStack, const size_t startIndex, const CharSet& chars) noexcept
 {
-    if (needlesSize != 0 && startIndex < haySize)
-    {
-        const StringMatchHelper matchHelper = generateStringMatchHelper(needles, needlesSize);
-        const char* const end = hayStack + haySize;
-        for (const char* position = hayStack + startIndex; position < end; ++position)
-        {
-            if (matchHelper.hasMatch(*position))
-            {
-                return static_cast<size_t>(position - hayStack);
-            }
-        }
-    }
-    return INDEX_NOT_FOUND;
+    const char* const match = Simd::Dispatch::rFindCharClass<negate>(hayStack, startIndex + 1, chars.data());
+    return (match != nullptr) ? static_cast<size_t>(match - hayStack) : INDEX_NOT_FOUND;
 }
+#endif
 
 
 /**
-* Implementation of string_view::find_first_not_of (MSVC implementation)
-* Keep around for C++11 compatibility
+* Finds the first char in [hayStack + startIndex, hayStack + haySize) that is in needles
 */
-constexpr size_t findAnyBut(const char* const hayStack, const size_t haySize, const size_t startIndex, const char* const needles, const size_t needlesSize) noexcept
+constexpr inline size_t findAnyOf(const char* const hayStack, const size_t haySize, const size_t startIndex, const CharSet& needles) noexcept
 {
     if (startIndex < haySize)
     {
-        const StringMatchHelper matchHelper = generateStringMatchHelper(needles, needlesSize);
-        const char* const end = hayStack + haySize;
-        for (const char* position = hayStack + startIndex; position < end; ++position)
+#if STRINGUTILS_HAS_SIMD_CLASSIFY
+        if (!isConstantEvaluated())
+        {
+            return findCharClass<false>(hayStack, haySize, startIndex, needles);
+        }
+#endif
+        for (const char* position = hayStack + startIndex; position != hayStack + haySize; ++position)
         {
-            if (!matchHelper.hasMatch(*position))
+            if (needles.contains(*position))
             {
                 return static_cast<size_t>(position - hayStack);
             }
@@ -635,1198 +795,3755 @@ constexpr size_t findAnyBut(const char* const hayStack, const size_t haySize, co
     return INDEX_NOT_FOUND;
 }
 
-
-constexpr inline size_t rFind(const char* const hayStack, const size_t haySize, const size_t startIndex, const char needle) noexcept
+/**
+* Finds the first char in [hayStack + startIndex, hayStack + haySize) that is not in needles
+*/
+constexpr inline size_t findAnyBut(const char* const hayStack, const size_t haySize, const size_t startIndex, const CharSet& needles) noexcept
 {
     if (startIndex < haySize)
     {
-        const char* match = rFindChar(hayStack + startIndex, haySize + 1 - startIndex, needle);
-        if (match != nullptr)
+#if STRINGUTILS_HAS_SIMD_CLASSIFY
+        if (!isConstantEvaluated())
         {
-            return static_cast<size_t>(match - hayStack);
+            return findCharClass<true>(hayStack, haySize, startIndex, needles);
         }
-    }
-    return INDEX_NOT_FOUND;
-}
-
-
-constexpr inline size_t rFind(const char* const hayStack, const size_t haySize, const size_t startIndex, const char* const needle, const size_t needleSize) noexcept
-{
-    if (needleSize == 0)
-    {
-        return std::min(startIndex, haySize);
-    }
-
-    if (needleSize <= haySize)
-    {
-        for (const char* position = hayStack + std::min(startIndex, haySize - needleSize);; --position)
+#endif
+        for (const char* position = hayStack + startIndex; position != hayStack + haySize; ++position)
         {
-            if (charEquals(*position, *needle) && equals(position, needle, needleSize))
+            if (!needles.contains(*position))
             {
                 return static_cast<size_t>(position - hayStack);
             }
-
-            if (position == hayStack)
-            {
-                break;
-            }
         }
     }
     return INDEX_NOT_FOUND;
 }
 
 /**
-* Implementation of string_view::find_last_of (MSVC implementation)
-* Keep around for C++11 compatibility
+* Finds the last char in [hayStack, hayStack + startIndex] that is in needles, startIndex may be past the end
 */
-constexpr size_t rFindAnyOf(const char* const hayStack, const size_t haySize, const size_t startIndex, const char* const needles, const size_t needlesSize) noexcept
+constexpr inline size_t rFindAnyOf(const char* const hayStack, const size_t haySize, const size_t startIndex, const CharSet& needles) noexcept
 {
-    if (needlesSize != 0 && startIndex < haySize)
+    if (haySize != 0)
     {
-        const StringMatchHelper matchHelper = generateStringMatchHelper(needles, needlesSize);
-        const char* const end = hayStack + haySize;
-        for (const char* position = hayStack + std::min(startIndex, haySize);; --position)
+        const size_t last = std::min(startIndex, haySize - 1);
+#if STRINGUTILS_HAS_SIMD_CLASSIFY
+        if (!isConstantEvaluated())
         {
-            if (matchHelper.hasMatch(*position))
+            return rFindCharClass<false>(hayStack, last, needles);
+        }
+#endif
+        for (const char* position = hayStack + last + 1; position != hayStack;)
+        {
+            --position;
+            if (needles.contains(*position))
             {
                 return static_cast<size_t>(position - hayStack);
             }
-            if (position == hayStack)
-            {
-                break;
-            }
         }
     }
     return INDEX_NOT_FOUND;
 }
 
-
 /**
-* Implementation of string_view::find_first_not_of (MSVC implementation)
-* Keep around for C++11 compatibility
+* Finds the last char in [hayStack, hayStack + startIndex] that is not in needles, startIndex may be past the end
 */
-constexpr size_t rFindAnyBut(const char* const hayStack, const size_t haySize, const size_t startIndex, const char* const needles, const size_t needlesSize) noexcept
+constexpr inline size_t rFindAnyBut(const char* const hayStack, const size_t haySize, const size_t startIndex, const CharSet& needles) noexcept
 {
-    if (startIndex < haySize)
+    if (haySize != 0)
     {
-        const StringMatchHelper matchHelper = generateStringMatchHelper(needles, needlesSize);
-        const char* const end = hayStack + haySize;
-        for (const char* position = hayStack + std::min(startIndex, haySize);; --position)
+        const size_t last = std::min(startIndex, haySize - 1);
+#if STRINGUTILS_HAS_SIMD_CLASSIFY
+        if (!isConstantEvaluated())
+        {
+            return rFindCharClass<true>(hayStack, last, needles);
+        }
+#endif
+        for (const char* position = hayStack + last + 1; position != hayStack;)
         {
-            if (!matchHelper.hasMatch(*position))
+            --position;
+            if (!needles.contains(*position))
             {
                 return static_cast<size_t>(position - hayStack);
             }
-            if (position == hayStack)
-            {
-                break;
-            }
         }
     }
     return INDEX_NOT_FOUND;
 }
 
 
-constexpr inline size_t iFind(const char* const hayStack, const size_t haySize, const size_t startIndex, const char needle) noexcept
+#ifndef STRINGUTILS_TWO_WAY_THRESHOLD
+#    define STRINGUTILS_TWO_WAY_THRESHOLD 32
+#endif
+
+/**
+* Needles longer than this are searched by findLongNeedle, which falls back to the Two-Way algorithm if the filter gets too expensive
+* Shorter needles use the (simd) first and last char filter, which is faster on typical input but O(n*m) in the worst case
+*/
+static constexpr size_t twoWayThreshold{ STRINGUTILS_TWO_WAY_THRESHOLD };
+
+/**
+* findLongNeedle verifies candidates until it has compared more than this many chars per scanned char, then it switches to Two-Way
+*/
+static constexpr size_t verificationBudget{ 8 };
+
+template<bool ignoreCase>
+constexpr inline uchar foldChar(const char c) noexcept
 {
-    if (startIndex < haySize)
-    {
-        const char* match = iFindChar(hayStack + startIndex, haySize + 1 - startIndex, needle);
-        if (match != nullptr)
-        {
-            return static_cast<size_t>(match - hayStack);
-        }
-    }
-    return INDEX_NOT_FOUND;
+    return static_cast<uchar>(ignoreCase ? charToLowerCase(c) : c);
 }
 
-
-constexpr inline size_t iFind(const char* const hayStack, const size_t haySize, const size_t startIndex, const char* const needle, const size_t needleSize) noexcept
+/**
+* Char index of str read front to back, or back to front if backward is set (folded if ignoreCase)
+* The backward search runs Two-Way on the reversed haystack and needle, its first match is the last one
+*/
+template<bool ignoreCase, bool backward>
+constexpr inline uchar charAt(const char* const str, const size_t size, const size_t index) noexcept
 {
-    if (needleSize > haySize || startIndex > haySize - needleSize)
-    {
-        return INDEX_NOT_FOUND;
-    }
+    return foldChar<ignoreCase>(backward ? str[size - 1 - index] : str[index]);
+}
 
-    if (needleSize == 0)
-    {
-        return startIndex;
-    }
+/**
+* Critical factorization of a needle for the Two-Way algorithm (Crochemore-Perrin)
+* needle is split into [0, split) and [split, needleSize), period is the period of the right part
+* If periodic is true the period of the right part is also the period of the whole needle
+*/
+struct TwoWayFactorization
+{
+    size_t split = 0;
+    size_t period = 1;
+    bool periodic = false;
+};
 
-    const char* const end = hayStack + (haySize + 1 - needleSize);
-    for (const char* position = hayStack + startIndex;; ++position)
+/**
+* Computes the start of the maximal suffix of needle and its period
+* reversed selects the reversed alphabet order, the factorization uses the longer of both suffixes
+*/
+template<bool ignoreCase, bool backward>
+constexpr inline TwoWayFactorization maximalSuffix(const char* const needle, const size_t needleSize, const bool reversed) noexcept
+{
+    size_t suffixStart = 0; // start of the maximal suffix
+    size_t j = 1;
+    size_t k = 0;
+    size_t period = 1;
+    while (j + k < needleSize)
     {
-        position = iFindChar(position, static_cast<size_t>(end - position), *needle); // Searches for the first character of needle
-        if (position == nullptr)
+        const uchar a = charAt<ignoreCase, backward>(needle, needleSize, j + k);
+        const uchar b = charAt<ignoreCase, backward>(needle, needleSize, suffixStart + k);
+        if (a == b)
         {
-            return INDEX_NOT_FOUND;
+            if (++k == period)
+            {
+                j += period;
+                k = 0;
+            }
         }
-
-        if (iEquals(position, needle, needleSize)) // found match
+        else if ((a < b) != reversed)
         {
-            return static_cast<size_t>(position - hayStack);
+            j += k + 1;
+            k = 0;
+            period = j - suffixStart;
+        }
+        else
+        {
+            suffixStart = j++;
+            k = 0;
+            period = 1;
         }
     }
+    TwoWayFactorization factorization;
+    factorization.split = suffixStart;
+    factorization.period = period;
+    return factorization;
 }
 
-/**
-* Finds the first occurrence case insensitively of any of the chars in [needles, needles + needlesSize)
-* Uses a lookup array for the needles => O(n) instead of O(n^2)
-*/
-constexpr size_t iFindAnyOf(const char* const hayStack, const size_t haySize, const size_t startIndex, const char* const needles, const size_t needlesSize) noexcept
+template<bool ignoreCase, bool backward = false>
+constexpr inline TwoWayFactorization computeTwoWayFactorization(const char* const needle, const size_t needleSize) noexcept
 {
-    if (needlesSize != 0 && startIndex < haySize)
+    const TwoWayFactorization forward = maximalSuffix<ignoreCase, backward>(needle, needleSize, false);
+    const TwoWayFactorization reverse = maximalSuffix<ignoreCase, backward>(needle, needleSize, true);
+    TwoWayFactorization factorization = (forward.split > reverse.split) ? forward : reverse;
+
+    factorization.periodic = true;
+    for (size_t j = 0; j < factorization.split; ++j)
     {
-        const StringMatchHelper matchHelper = iGenerateStringMatchHelper(needles, needlesSize);
-        const char* const end = hayStack + haySize;
-        for (const char* position = hayStack + startIndex; position < end; ++position)
+        if (charAt<ignoreCase, backward>(needle, needleSize, j) != charAt<ignoreCase, backward>(needle, needleSize, j + factorization.period))
         {
-            if (matchHelper.hasMatch(*position))
-            {
-                return static_cast<size_t>(position - hayStack);
-            }
+            factorization.periodic = false;
+            break;
         }
     }
-    return INDEX_NOT_FOUND;
+    if (!factorization.periodic)
+    { // there is no period larger than this, we can shift by it after a match of the right part
+        factorization.period = std::max(factorization.split, needleSize - factorization.split) + 1;
+    }
+    return factorization;
 }
 
-
 /**
-* Finds the first occurrence case insensitively of any except the chars in [needles, needles + needlesSize)
-* Uses a lookup array for the needles => O(n) instead of O(n^2)
+* Two-Way string matching: linear time and constant space
+* Returns the index of the first occurrence of needle in [hayStack + startIndex, hayStack + haySize) or INDEX_NOT_FOUND
+* If backward is set, hayStack and needle are read reversed and so are startIndex and the result
+* Requires 0 < needleSize and startIndex + needleSize <= haySize, factorization must be computed with the same backward
 */
-constexpr size_t iFindAnyBut(const char* const hayStack, const size_t haySize, const size_t startIndex, const char* const needles, const size_t needlesSize) noexcept
+template<bool ignoreCase, bool backward = false>
+constexpr inline size_t twoWayFind(const char* const hayStack, const size_t haySize, const size_t startIndex, const char* const needle, const size_t needleSize, const TwoWayFactorization factorization) noexcept
 {
-    if (startIndex < haySize)
+    const size_t split = factorization.split;
+    const size_t period = factorization.period;
+    size_t memory = 0; // prefix of the needle which is known to match at the current position (periodic case only)
+    for (size_t position = startIndex; position <= haySize - needleSize;)
     {
-        const StringMatchHelper matchHelper = iGenerateStringMatchHelper(needles, needlesSize);
-        const char* const end = hayStack + haySize;
-        for (const char* position = hayStack + startIndex; position < end; ++position)
+        size_t i = std::max(split, memory);
+        while (i < needleSize && charAt<ignoreCase, backward>(needle, needleSize, i) == charAt<ignoreCase, backward>(hayStack, haySize, position + i))
         {
-            if (!matchHelper.hasMatch(*position))
-            {
-                return static_cast<size_t>(position - hayStack);
-            }
+            ++i;
+        }
+        if (i < needleSize)
+        { // mismatch in the right part
+            position += i + 1 - split;
+            memory = 0;
+            continue;
         }
+
+        i = split;
+        while (i > memory && charAt<ignoreCase, backward>(needle, needleSize, i - 1) == charAt<ignoreCase, backward>(hayStack, haySize, position + i - 1))
+        {
+            --i;
+        }
+        if (i <= memory)
+        {
+            return position;
+        }
+        position += period;
+        memory = factorization.periodic ? needleSize - period : 0;
     }
     return INDEX_NOT_FOUND;
 }
 
-
-constexpr inline size_t irFind(const char* const hayStack, const size_t haySize, const size_t startIndex, const char needle) noexcept
+/**
+* The Two-Way factorization of a needle, computed on first use
+* One instance is shared by the find calls of a search loop (split, count, findAll), so it is computed at most once per loop
+*/
+template<bool ignoreCase, bool backward = false>
+class LazyTwoWay
 {
-    if (startIndex < haySize)
+  private:
+    TwoWayFactorization m_Factorization;
+    bool m_Computed = false;
+
+  public:
+    constexpr LazyTwoWay() noexcept = default;
+
+    constexpr explicit LazyTwoWay(const TwoWayFactorization& factorization) noexcept
+        : m_Factorization(factorization)
+        , m_Computed(true)
     {
-        const char* match = irFindChar(hayStack + startIndex, haySize + 1 - startIndex, needle);
-        if (match != nullptr)
+    }
+
+    constexpr const TwoWayFactorization& get(const char* const needle, const size_t needleSize) noexcept
+    {
+        if (!m_Computed)
         {
-            return static_cast<size_t>(match - hayStack);
+            m_Factorization = computeTwoWayFactorization<ignoreCase, backward>(needle, needleSize);
+            m_Computed = true;
         }
+        return m_Factorization;
     }
-    return INDEX_NOT_FOUND;
-}
-
+};
 
-constexpr inline size_t irFind(const char* const hayStack, const size_t haySize, const size_t startIndex, const char* const needle, const size_t needleSize) noexcept
+/**
+* Search for needles longer than twoWayThreshold. The (simd) filter on the chars at offset1 and offset2 proposes candidates,
+* once verifying them has cost more than verificationBudget chars per scanned char, the rest is searched with Two-Way.
+* So typical input runs at the speed of the filter and the worst case stays linear.
+* Requires 0 < needleSize, startIndex + needleSize <= haySize and offset1, offset2 < needleSize
+*/
+template<bool ignoreCase>
+constexpr inline size_t findLongNeedle(const char* const hayStack, const size_t haySize, const size_t startIndex, const char* const needle, const size_t needleSize,
+    const size_t offset1, const size_t offset2, LazyTwoWay<ignoreCase>& twoWay) noexcept
 {
-
-    if (needleSize == 0)
+    size_t match = INDEX_NOT_FOUND;
+    size_t resume = INDEX_NOT_FOUND;
+    size_t work = 0;
+    const auto verify = [&](const size_t position) { // returns whether to go on with the next candidate
+        if (ignoreCase ? iEquals(hayStack + position, needle, needleSize) : equals(hayStack + position, needle, needleSize))
+        {
+            match = position;
+            return false;
+        }
+        work += needleSize;
+        if (work > verificationBudget * (position - startIndex + needleSize))
+        {
+            resume = position + 1;
+            return false;
+        }
+        return true;
+    };
+#if STRINGUTILS_HAS_SIMD
+    if (!isConstantEvaluated())
     {
-        return std::min(startIndex, haySize);
+        auto visitor = [&verify, startIndex](const size_t index) { return verify(startIndex + index); };
+        Simd::Dispatch::forEachCandidate<ignoreCase>(hayStack + startIndex, haySize - startIndex, needle, needleSize, offset1, offset2, visitor);
     }
-    if (needleSize <= haySize)
+    else
+#endif
     {
-        for (const char* position = hayStack + std::min(startIndex, haySize - needleSize);; --position)
+        const size_t end = haySize + 1 - needleSize; // one past the last possible start of a match
+        const uchar char2 = foldChar<ignoreCase>(needle[offset2]);
+        for (size_t position = startIndex; position < end; ++position)
         {
-            if (charEqualsIgnoreCase(*position, *needle) && iEquals(position, needle, needleSize))
+            const char* const candidate = ignoreCase ? iFindChar(hayStack + position + offset1, end - position, needle[offset1])
+                                                     : findChar(hayStack + position + offset1, end - position, needle[offset1]);
+            if (candidate == nullptr)
             {
-                return static_cast<size_t>(position - hayStack);
+                break;
             }
-
-            if (position == hayStack)
+            position = static_cast<size_t>(candidate - hayStack) - offset1;
+            if (foldChar<ignoreCase>(hayStack[position + offset2]) == char2 && !verify(position))
             {
                 break;
             }
         }
     }
-    return INDEX_NOT_FOUND;
+    if (resume != INDEX_NOT_FOUND && resume + needleSize <= haySize)
+    {
+        return twoWayFind<ignoreCase>(hayStack, haySize, resume, needle, needleSize, twoWay.get(needle, needleSize));
+    }
+    return match;
 }
 
-
 /**
-* Finds the last occurrence case insensitively of any of the chars in [needles, needles + needlesSize)
-* Uses a lookup array for the needles => O(n) instead of O(n^2)
+* Last occurrence of a needle longer than twoWayThreshold that starts at or before last
+* The candidates come from the (simd) reverse search of the first char, once verifying them gets too expensive the rest is
+* searched with the backward Two-Way
+* Requires 0 < needleSize and last + needleSize <= haySize
 */
-constexpr size_t irFindAnyOf(const char* const hayStack, const size_t haySize, const size_t startIndex, const char* const needles, const size_t needlesSize) noexcept
+template<bool ignoreCase>
+constexpr inline size_t rFindLongNeedle(const char* const hayStack, const size_t last, const char* const needle, const size_t needleSize) noexcept
 {
-    if (needlesSize != 0 && startIndex < haySize)
+    const size_t limit = last + needleSize; // the matches lie in [hayStack, hayStack + limit)
+    size_t work = 0;
+    for (size_t end = last + 1; end != 0;)
     {
-        const StringMatchHelper matchHelper = iGenerateStringMatchHelper(needles, needlesSize);
-        const char* const end = hayStack + haySize;
-        for (const char* position = hayStack + std::min(startIndex, haySize);; --position)
+        const char* const candidate = ignoreCase ? irFindChar(hayStack, end, needle[0]) : rFindChar(hayStack, end, needle[0]);
+        if (candidate == nullptr)
         {
-            if (matchHelper.hasMatch(*position))
-            {
-                return static_cast<size_t>(position - hayStack);
-            }
-            if (position == hayStack)
+            break;
+        }
+        const size_t position = static_cast<size_t>(candidate - hayStack);
+        if (ignoreCase ? iEquals(candidate, needle, needleSize) : equals(candidate, needle, needleSize))
+        {
+            return position;
+        }
+        work += needleSize;
+        if (work > verificationBudget * (last - position + needleSize))
+        { // the starts before position are [0, limit - position - needleSize + 1) read backward
+            if (position == 0)
             {
                 break;
             }
+            const size_t reversedStart = limit - position - needleSize + 1;
+            const size_t match = twoWayFind<ignoreCase, true>(hayStack, limit, reversedStart, needle, needleSize, computeTwoWayFactorization<ignoreCase, true>(needle, needleSize));
+            return (match != INDEX_NOT_FOUND) ? limit - match - needleSize : INDEX_NOT_FOUND;
         }
+        end = position;
     }
     return INDEX_NOT_FOUND;
 }
 
 
-/**
-* Finds the last occurrence case insensitively of none of the chars in [needles, needles + needlesSize)
-* Uses a lookup array for the needles => O(n) instead of O(n^2)
-*/
-constexpr size_t irFindAnyBut(const char* const hayStack, const size_t haySize, const size_t startIndex, const char* const needles, const size_t needlesSize) noexcept
+constexpr inline size_t find(const char* hayStack, const size_t haySize, const size_t startIndex, char needle) noexcept
 {
     if (startIndex < haySize)
     {
-        const StringMatchHelper matchHelper = iGenerateStringMatchHelper(needles, needlesSize);
-        const char* const end = hayStack + haySize;
-        for (const char* position = hayStack + std::min(startIndex, haySize);; --position)
+        const char* match = findChar(hayStack + startIndex, haySize - startIndex, needle);
+        if (match != nullptr)
         {
-            if (!matchHelper.hasMatch(*position))
-            {
-                return static_cast<size_t>(position - hayStack);
-            }
-            if (position == hayStack)
-            {
-                break;
-            }
+            return static_cast<size_t>(match - hayStack);
         }
     }
     return INDEX_NOT_FOUND;
 }
 
 
-template<typename Delimiter>
-static inline std::string join(const Delimiter&) noexcept
-{
-    return std::string();
-}
-
-template<typename Delimiter, typename Arg0, typename... Args>
-static inline std::string join(const Delimiter& delimiter, Arg0&& arg0, Args&&... args)
+/**
+* Search loops (split, count, findAll) pass the same twoWay to every call, so a long needle is factorized at most once
+*/
+constexpr inline size_t find(const char* hayStack, const size_t haySize, const size_t startIndex, const char* needle, const size_t needleSize, LazyTwoWay<false>& twoWay) noexcept
 {
-    constexpr size_t argCount = sizeof...(args) + 1;
-    if constexpr (argCount == 1)
-    { // we only have one argument so we can return it
-        return makeString(std::forward<Arg0>(arg0));
+    if (needleSize > haySize || startIndex > haySize - needleSize)
+    {
+        return INDEX_NOT_FOUND;
     }
-    const size_t delimiterSize = Detail::getStringSize(delimiter);
-    const auto sizes = Detail::makeSizesArray(arg0, args...);
-    const size_t totalSize = Detail::totalSizeHelper(sizes) + delimiterSize * (argCount - 1);
-    std::string result(totalSize, char{}); // note: initialization and memcpy is faster than reserve and +=
-    char* copyDestination = &result[0];
-    Detail::copyToString(std::forward<Arg0>(arg0), sizes[0], copyDestination);
-    size_t index = 1;
-    copyDestination += sizes[0];
-    ((
-         Detail::copyToString(delimiter, delimiterSize, copyDestination),
-         Detail::copyToString(args, sizes[index], copyDestination + delimiterSize),
-         copyDestination += delimiterSize + sizes[index++]),
-        ...);
-    return result;
-}
 
+    if (needleSize == 0)
+    {
+        return startIndex;
+    }
 
-template<typename Delimiter, typename... Args>
-static inline std::string joinOptional(const Delimiter& delimiter, Args&&... args)
-{
-    constexpr size_t argCount = sizeof...(args);
-    if constexpr (argCount == 0)
+    if (needleSize > twoWayThreshold)
     {
-        return std::string();
+        return findLongNeedle<false>(hayStack, haySize, startIndex, needle, needleSize, 0, needleSize - 1, twoWay);
     }
-    if constexpr (argCount == 1) // we only have one argument so we can return it
+
+#if STRINGUTILS_HAS_SIMD
+    if (!isConstantEvaluated() && needleSize > 1)
     {
-        return Detail::makeString(std::forward<Args>(args)...);
+        const char* const match = Simd::Dispatch::findSubstring(hayStack + startIndex, haySize - startIndex, needle, needleSize);
+        return (match != nullptr) ? static_cast<size_t>(match - hayStack) : INDEX_NOT_FOUND;
     }
-    const size_t delimiterSize = Detail::getStringSize(delimiter);
-    const auto sizes = Detail::makeSizesArray(args...);
-    const size_t validArgumentCount = Detail::joinOptionalArgumentCount(args...);
-    const size_t delimiterCount = (validArgumentCount != 0) ? validArgumentCount - 1 : 0;
-    const size_t totalSize = Detail::totalSizeHelper(sizes) + delimiterSize * delimiterCount;
-    std::string result(totalSize, char{}); // note: initialization and memcpy is faster than reserve and +=
-    char* copyDestination = &result[0];
-    bool isFirst = true;
-    size_t index = 0;
-    ((
-         isFirst = Detail::joinOptionalCopyHelper(isFirst, args, sizes[index], delimiter, delimiterSize, copyDestination),
-         ++index),
-        ...);
-    return result;
-}
+#endif
 
+    const char* const end = hayStack + (haySize + 1 - needleSize);
+    for (const char* position = hayStack + startIndex;; ++position)
+    {
+        position = findChar(position, static_cast<size_t>(end - position), *needle); // Searches for the first character of needle
+        if (position == nullptr)
+        {
+            return INDEX_NOT_FOUND;
+        }
 
-template<typename... Args>
-static inline std::string concat(Args&&... args)
-{
-    constexpr size_t argCount = sizeof...(args);
-    if constexpr (argCount == 0)
-    { // we only have one argument so we can return it
-        return std::string();
-    }
-    if constexpr (argCount == 1)
-    { // we only have one argument so we can return it
-        return Detail::makeString(std::forward<Args>(args)...);
+        if (equals(position, needle, needleSize)) // found match
+        {
+            return static_cast<size_t>(position - hayStack);
+        }
     }
-    const auto sizes = Detail::makeSizesArray(args...);
-    const size_t totalSize = Detail::totalSizeHelper(sizes);
-    std::string result(totalSize, char{}); // note: initialization and memcpy is faster than reserve and +=
-    char* copyDestination = &result[0];
-    size_t index = 0;
-    ((
-         Detail::copyToString(args, sizes[index], copyDestination),
-         copyDestination += sizes[index++]),
-        ...);
-    return result;
 }
 
+constexpr inline size_t find(const char* hayStack, const size_t haySize, const size_t startIndex, const char* needle, const size_t needleSize) noexcept
+{
+    LazyTwoWay<false> twoWay;
+    return find(hayStack, haySize, startIndex, needle, needleSize, twoWay);
+}
 
-template<class StringOrStringView, typename std::enable_if<std::is_same<StringOrStringView, std::string>::value, bool>::type = true>
-inline void assign(StringOrStringView& str, const char* ptr, const size_t size)
+/**
+* Implementation of string_view::find_first_of (MSVC implementation)
+* Keep around for C++11 compatibility
+*/
+constexpr size_t findAnyOf(const char* const hayStack, const size_t haySize, const size_t startIndex, const char* const needles, const size_t needlesSize) noexcept
 {
-    str.assign(ptr, size);
+    return findAnyOf(hayStack, haySize, startIndex, CharSet(std::string_view(needles, needlesSize)));
 }
-template<class StringOrStringView, typename std::enable_if<std::is_same<StringOrStringView, std::string_view>::value, bool>::type = true>
-constexpr inline void assign(StringOrStringView& str, const char* ptr, const size_t size)
+
+
+/**
+* Implementation of string_view::find_first_not_of (MSVC implementation)
+* Keep around for C++11 compatibility
+*/
+constexpr size_t findAnyBut(const char* const hayStack, const size_t haySize, const size_t startIndex, const char* const needles, const size_t needlesSize) noexcept
 {
-    str = std::string_view(ptr, size);
+    return findAnyBut(hayStack, haySize, startIndex, CharSet(std::string_view(needles, needlesSize)));
 }
 
 
-template<class StringOrStringView, class StringView, typename std::enable_if<std::is_same<StringOrStringView, StringView>::value, bool>::type = true>
-inline std::vector<StringView> splitNoSeparator(StringView source)
+constexpr inline size_t rFind(const char* const hayStack, const size_t haySize, const size_t startIndex, const char needle) noexcept
 {
-    const size_t sourceLength = source.length();
-    std::vector<StringView> list(sourceLength + 1);
-    for (size_t j = 0; j < sourceLength; ++j)
+    if (haySize != 0)
     {
-        list[j + 1] = StringView(source.data() + j, 1);
+        const char* match = rFindChar(hayStack, std::min(startIndex, haySize - 1) + 1, needle);
+        if (match != nullptr)
+        {
+            return static_cast<size_t>(match - hayStack);
+        }
     }
-    return list;
+    return INDEX_NOT_FOUND;
 }
 
-template<class StringOrStringView, class StringView, typename std::enable_if<std::is_same<StringOrStringView, StringView>::value, bool>::type = true>
-inline std::vector<StringView> splitNoSeparator(StringView source, size_t maxSplits)
+
+constexpr inline size_t rFind(const char* const hayStack, const size_t haySize, const size_t startIndex, const char* const needle, const size_t needleSize) noexcept
 {
-    const size_t sourceLength = source.length();
-    maxSplits = std::min(maxSplits, sourceLength);
-    if (maxSplits == 0)
+    if (needleSize == 0)
     {
-        return std::vector<StringView>(1, source);
+        return std::min(startIndex, haySize);
     }
 
-    std::vector<StringOrStringView> list(maxSplits + 1);
-    list[0] = StringOrStringView(source.data(), 0); // we want this empty string_view be in range of source
-    for (size_t j = 0; j < maxSplits - 1; ++j)
+    if (needleSize <= haySize)
     {
-        list[j + 1] = StringView(source.data() + j, 1);
-    }
-    list[maxSplits] = StringView(source.data() + maxSplits - 1, sourceLength + 1 - maxSplits);
-    return list;
-}
+        const size_t last = std::min(startIndex, haySize - needleSize);
+        if (needleSize > twoWayThreshold)
+        {
+            return rFindLongNeedle<false>(hayStack, last, needle, needleSize);
+        }
+#if STRINGUTILS_HAS_SIMD
+        if (!isConstantEvaluated())
+        {
+            const char* const match = (needleSize == 1) ? Simd::Dispatch::rFindChar(hayStack, last + 1, *needle) : Simd::Dispatch::rFindSubstring(hayStack, last + needleSize, needle, needleSize);
+            return (match != nullptr) ? static_cast<size_t>(match - hayStack) : INDEX_NOT_FOUND;
+        }
+#endif
+        for (const char* position = hayStack + last;; --position)
+        {
+            if (charEquals(*position, *needle) && equals(position, needle, needleSize))
+            {
+                return static_cast<size_t>(position - hayStack);
+            }
 
-template<class StringOrStringView, class StringView, typename std::enable_if<std::is_same<StringOrStringView, std::string>::value, bool>::type = true>
-inline std::vector<std::string> splitNoSeparator(StringView source)
-{
-    const size_t sourceLength = source.length();
-    std::vector<std::string> list(sourceLength + 1, std::string(1, '?'));
-    list[0].clear();
-    for (size_t j = 0; j < sourceLength; ++j)
-    {
-        list[j + 1][0] = source[j];
+            if (position == hayStack)
+            {
+                break;
+            }
+        }
     }
-    return list;
+    return INDEX_NOT_FOUND;
 }
 
-template<class StringOrStringView, class StringView, typename std::enable_if<std::is_same<StringOrStringView, std::string>::value, bool>::type = true>
-inline std::vector<std::string> splitNoSeparator(StringView source, size_t maxSplits)
-{
-    const size_t sourceLength = source.length();
-    maxSplits = std::min(maxSplits, sourceLength);
-    if (maxSplits == 0)
+/**
+* Implementation of string_view::find_last_of (MSVC implementation)
+* Keep around for C++11 compatibility
+*/
+constexpr size_t rFindAnyOf(const char* const hayStack, const size_t haySize, const size_t startIndex, const char* const needles, const size_t needlesSize) noexcept
+{
+    return rFindAnyOf(hayStack, haySize, startIndex, CharSet(std::string_view(needles, needlesSize)));
+}
+
+
+/**
+* Implementation of string_view::find_last_not_of (MSVC implementation)
+* Keep around for C++11 compatibility
+*/
+constexpr size_t rFindAnyBut(const char* const hayStack, const size_t haySize, const size_t startIndex, const char* const needles, const size_t needlesSize) noexcept
+{
+    return rFindAnyBut(hayStack, haySize, startIndex, CharSet(std::string_view(needles, needlesSize)));
+}
+
+
+constexpr inline size_t iFind(const char* const hayStack, const size_t haySize, const size_t startIndex, const char needle) noexcept
+{
+    if (startIndex < haySize)
     {
-        return constructSingleElementVector<std::string>(source);
+        const char* match = iFindChar(hayStack + startIndex, haySize - startIndex, needle);
+        if (match != nullptr)
+        {
+            return static_cast<size_t>(match - hayStack);
+        }
     }
-    std::vector<std::string> list(maxSplits + 1, std::string(1, '?'));
-    list[0].clear();
-    for (size_t j = 0; j < maxSplits - 1; ++j)
+    return INDEX_NOT_FOUND;
+}
+
+
+constexpr inline size_t iFind(const char* const hayStack, const size_t haySize, const size_t startIndex, const char* const needle, const size_t needleSize) noexcept
+{
+    if (needleSize > haySize || startIndex > haySize - needleSize)
     {
-        list[j + 1][0] = source[j];
+        return INDEX_NOT_FOUND;
     }
-    list[maxSplits].assign(source.data() + maxSplits - 1, sourceLength + 1 - maxSplits);
-    return list;
+
+    if (needleSize == 0)
+    {
+        return startIndex;
+    }
+
+    if (needleSize > twoWayThreshold)
+    {
+        LazyTwoWay<true> twoWay;
+        return findLongNeedle<true>(hayStack, haySize, startIndex, needle, needleSize, 0, needleSize - 1, twoWay);
+    }
+
+#if STRINGUTILS_HAS_SIMD
+    if (!isConstantEvaluated())
+    {
+        const char* const match = Simd::Dispatch::iFindSubstring(hayStack + startIndex, haySize - startIndex, needle, needleSize, 0, needleSize - 1);
+        return (match != nullptr) ? static_cast<size_t>(match - hayStack) : INDEX_NOT_FOUND;
+    }
+#endif
+
+    const char* const end = hayStack + (haySize + 1 - needleSize);
+    for (const char* position = hayStack + startIndex;; ++position)
+    {
+        position = iFindChar(position, static_cast<size_t>(end - position), *needle); // Searches for the first character of needle
+        if (position == nullptr)
+        {
+            return INDEX_NOT_FOUND;
+        }
+
+        if (iEquals(position, needle, needleSize)) // found match
+        {
+            return static_cast<size_t>(position - hayStack);
+        }
+    }
+}
+
+/**
+* Finds the first occurrence case insensitively of any of the chars in [needles, needles + needlesSize)
+* Uses a CharSet for the needles => O(n) instead of O(n^2)
+*/
+constexpr size_t iFindAnyOf(const char* const hayStack, const size_t haySize, const size_t startIndex, const char* const needles, const size_t needlesSize) noexcept
+{
+    return findAnyOf(hayStack, haySize, startIndex, CharSet().iAdd(std::string_view(needles, needlesSize)));
 }
 
 
-template<class StringOrStringView, class StringView, size_t maxSplits, typename std::enable_if<std::is_same<StringOrStringView, StringView>::value, bool>::type = true>
-constexpr inline STRINGUTILS_NAMESPACE::SplitResult<StringOrStringView, maxSplits> splitNoSeparator(StringView source)
+/**
+* Finds the first occurrence case insensitively of any except the chars in [needles, needles + needlesSize)
+* Uses a CharSet for the needles => O(n) instead of O(n^2)
+*/
+constexpr size_t iFindAnyBut(const char* const hayStack, const size_t haySize, const size_t startIndex, const char* const needles, const size_t needlesSize) noexcept
 {
-    STRINGUTILS_NAMESPACE::SplitResult<StringOrStringView, maxSplits> result;
-    const size_t sourceLength = source.length();
-    const size_t totalSplits = std::min(maxSplits, sourceLength);
-    result.size = totalSplits + 1;
-    if (totalSplits == 0)
+    return findAnyBut(hayStack, haySize, startIndex, CharSet().iAdd(std::string_view(needles, needlesSize)));
+}
+
+
+constexpr inline size_t irFind(const char* const hayStack, const size_t haySize, const size_t startIndex, const char needle) noexcept
+{
+    if (haySize != 0)
     {
-        result.parts[0] = source;
-        return result;
+        const char* match = irFindChar(hayStack, std::min(startIndex, haySize - 1) + 1, needle);
+        if (match != nullptr)
+        {
+            return static_cast<size_t>(match - hayStack);
+        }
     }
+    return INDEX_NOT_FOUND;
+}
 
-    result.parts[0] = StringView(source.data(), 0); // we want first empty string_view be in range of source
-    for (size_t j = 0; j < totalSplits - 1; ++j)
+
+constexpr inline size_t irFind(const char* const hayStack, const size_t haySize, const size_t startIndex, const char* const needle, const size_t needleSize) noexcept
+{
+    if (needleSize == 0)
     {
-        result.parts[j + 1] = StringView(source.data() + j, 1);
+        return std::min(startIndex, haySize);
     }
-    result.parts[totalSplits] = StringView(source.data() + totalSplits - 1, sourceLength + 1 - totalSplits);
-    return result;
+    if (needleSize <= haySize)
+    {
+        const size_t last = std::min(startIndex, haySize - needleSize);
+        if (needleSize > twoWayThreshold)
+        {
+            return rFindLongNeedle<true>(hayStack, last, needle, needleSize);
+        }
+#if STRINGUTILS_HAS_SIMD
+        if (!isConstantEvaluated())
+        {
+            const char* const match = Simd::Dispatch::irFindSubstring(hayStack, last + needleSize, needle, needleSize);
+            return (match != nullptr) ? static_cast<size_t>(match - hayStack) : INDEX_NOT_FOUND;
+        }
+#endif
+        for (const char* position = hayStack + last;; --position)
+        {
+            if (charEqualsIgnoreCase(*position, *needle) && iEquals(position, needle, needleSize))
+            {
+                return static_cast<size_t>(position - hayStack);
+            }
+
+            if (position == hayStack)
+            {
+                break;
+            }
+        }
+    }
+    return INDEX_NOT_FOUND;
 }
 
-template<class StringOrStringView, class StringView, size_t maxSplits, typename std::enable_if<std::is_same<StringOrStringView, std::string>::value, bool>::type = true>
-inline STRINGUTILS_NAMESPACE::SplitResult<StringOrStringView, maxSplits> splitNoSeparator(StringView source)
+
+/**
+* Finds the last occurrence case insensitively of any of the chars in [needles, needles + needlesSize)
+* Uses a CharSet for the needles => O(n) instead of O(n^2)
+*/
+constexpr size_t irFindAnyOf(const char* const hayStack, const size_t haySize, const size_t startIndex, const char* const needles, const size_t needlesSize) noexcept
 {
-    STRINGUTILS_NAMESPACE::SplitResult<StringOrStringView, maxSplits> result;
-    const size_t sourceLength = source.length();
-    const size_t totalSplits = std::min(maxSplits, sourceLength);
-    result.size = totalSplits + 1;
-    if (totalSplits == 0)
+    return rFindAnyOf(hayStack, haySize, startIndex, CharSet().iAdd(std::string_view(needles, needlesSize)));
+}
+
+
+/**
+* Finds the last occurrence case insensitively of none of the chars in [needles, needles + needlesSize)
+* Uses a CharSet for the needles => O(n) instead of O(n^2)
+*/
+constexpr size_t irFindAnyBut(const char* const hayStack, const size_t haySize, const size_t startIndex, const char* const needles, const size_t needlesSize) noexcept
+{
+    return rFindAnyBut(hayStack, haySize, startIndex, CharSet().iAdd(std::string_view(needles, needlesSize)));
+}
+
+
+/**
+* Counts the chars in [hayStack, hayStack + haySize) that equal needle
+*/
+constexpr inline size_t count(const char* const hayStack, const size_t haySize, const char needle) noexcept
+{
+#if STRINGUTILS_HAS_SIMD
+    if (!isConstantEvaluated())
     {
-        result.parts[0].assign(source.data(), source.size());
-        return result;
+        return Simd::Dispatch::countChar(hayStack, haySize, needle);
     }
-    for (size_t j = 0; j < totalSplits - 1; ++j)
+#endif
+    size_t matches = 0;
+    for (const char* position = hayStack; position != hayStack + haySize; ++position)
     {
-        result.parts[j + 1].assign(source.data() + j, 1);
+        matches += charEquals(*position, needle);
     }
-    result.parts[totalSplits].assign(source.data() + totalSplits - 1, sourceLength + 1 - totalSplits);
-    return result;
+    return matches;
 }
 
 
-template<class StringOrStringView, class StringView, typename std::enable_if<std::is_same<StringOrStringView, StringView>::value, bool>::type = true>
-inline std::vector<StringView> splitNoSeparatorSkipEmpty(StringView source)
+/**
+* Counts the non overlapping occurrences of needle, an empty needle matches haySize + 1 times
+*/
+constexpr inline size_t count(const char* const hayStack, const size_t haySize, const char* const needle, const size_t needleSize) noexcept
 {
-    const size_t sourceLength = source.length();
-    std::vector<StringView> list(sourceLength);
-    for (size_t j = 0; j < sourceLength; ++j)
+    if (needleSize == 0)
     {
-        list[j] = StringView(source.data() + j, 1);
+        return haySize + 1;
     }
-    return list;
+    if (needleSize == 1)
+    {
+        return count(hayStack, haySize, *needle);
+    }
+    size_t matches = 0;
+    LazyTwoWay<false> twoWay;
+    for (size_t position = find(hayStack, haySize, 0, needle, needleSize, twoWay); position != INDEX_NOT_FOUND; position = find(hayStack, haySize, position + needleSize, needle, needleSize, twoWay))
+    {
+        ++matches;
+    }
+    return matches;
 }
 
-template<class StringOrStringView, class StringView, typename std::enable_if<std::is_same<StringOrStringView, StringView>::value, bool>::type = true>
-inline std::vector<StringView> splitNoSeparatorSkipEmpty(StringView source, size_t maxSplits)
+
+/**
+* Counts the chars in [hayStack, hayStack + haySize) that are in needles
+*/
+constexpr inline size_t countAnyOf(const char* const hayStack, const size_t haySize, const CharSet& needles) noexcept
 {
-    const size_t sourceLength = source.length();
-    maxSplits = std::min(sourceLength, maxSplits);
-    if (maxSplits == 0)
+#if STRINGUTILS_HAS_SIMD_CLASSIFY
+    if (!isConstantEvaluated())
     {
-        return std::vector<StringView>(1, source);
+        return Simd::Dispatch::countCharClass(hayStack, haySize, needles.data());
     }
-    std::vector<StringView> list(maxSplits);
-    for (size_t j = 0; j < maxSplits - 1; ++j)
+#endif
+    size_t matches = 0;
+    for (const char* position = hayStack; position != hayStack + haySize; ++position)
     {
-        list[j] = StringView(source.data() + j, 1);
+        matches += needles.contains(*position);
     }
-    list[maxSplits - 1] = StringView(source.data() + maxSplits - 1, sourceLength + 1 - maxSplits);
-    return list;
+    return matches;
 }
 
-template<class StringOrStringView, class StringView, typename std::enable_if<std::is_same<StringOrStringView, std::string>::value, bool>::type = true>
-inline std::vector<StringOrStringView> splitNoSeparatorSkipEmpty(StringView source)
+
+/**
+* Calls visitor(index) for every char in [hayStack, hayStack + haySize) that equals needle, in order, until it returns false
+*/
+template<class Visitor>
+inline void forEachChar(const char* const hayStack, const size_t haySize, const char needle, Visitor& visitor)
 {
-    const size_t sourceLength = source.length();
-    std::vector<StringOrStringView> list(sourceLength, std::string(1, '?'));
-    for (size_t j = 0; j < sourceLength; ++j)
+#if STRINGUTILS_HAS_SIMD
+    Simd::Dispatch::forEachChar(hayStack, haySize, needle, visitor);
+#else
+    for (size_t index = 0; index < haySize; ++index)
     {
-        list[j][0] = source[j];
+        if (hayStack[index] == needle && !visitor(index))
+        {
+            return;
+        }
+    }
+#endif
+}
+
+/**
+* Calls visitor(index) for every char in [hayStack, hayStack + haySize) that is in chars (not in chars if negate is set), in order, until it returns false
+*/
+template<bool negate, class Visitor>
+inline void forEachCharClass(const char* const hayStack, const size_t haySize, const CharSet& chars, Visitor& visitor)
+{
+#if STRINGUTILS_HAS_SIMD_CLASSIFY
+    Simd::Dispatch::forEachCharClass<negate>(hayStack, haySize, chars.data(), visitor);
+#else
+    for (size_t index = 0; index < haySize; ++index)
+    {
+        if (chars.contains(hayStack[index]) != negate && !visitor(index))
+        {
+            return;
+        }
+    }
+#endif
+}
+
+
+/**
+* Writes the index of every char in [hayStack, hayStack + haySize) that equals needle to output
+*/
+template<class OutputIterator>
+inline OutputIterator findAll(const char* const hayStack, const size_t haySize, const char needle, OutputIterator output)
+{
+    auto visitor = [&output](const size_t index) {
+        *output = index;
+        ++output;
+        return true;
+    };
+    forEachChar(hayStack, haySize, needle, visitor);
+    return output;
+}
+
+
+/**
+* Writes the index of every non overlapping occurrence of needle to output, the same matches as count
+*/
+template<class OutputIterator>
+inline OutputIterator findAll(const char* const hayStack, const size_t haySize, const char* const needle, const size_t needleSize, OutputIterator output)
+{
+    if (needleSize == 1)
+    {
+        return findAll(hayStack, haySize, *needle, output);
+    }
+    const size_t step = std::max<size_t>(needleSize, 1);
+    LazyTwoWay<false> twoWay;
+    for (size_t position = find(hayStack, haySize, 0, needle, needleSize, twoWay); position != INDEX_NOT_FOUND; position = find(hayStack, haySize, position + step, needle, needleSize, twoWay))
+    {
+        *output = position;
+        ++output;
+    }
+    return output;
+}
+
+
+template<typename Delimiter>
+static inline std::string join(const Delimiter&) noexcept
+{
+    return std::string();
+}
+
+template<typename Delimiter, typename Arg0, typename... Args>
+static inline std::string join(const Delimiter& delimiter, Arg0&& arg0, Args&&... args)
+{
+    constexpr size_t argCount = sizeof...(args) + 1;
+    if constexpr (argCount == 1)
+    { // we only have one argument so we can return it
+        return makeString(std::forward<Arg0>(arg0));
+    }
+    const size_t delimiterSize = Detail::getStringSize(delimiter);
+    const auto sizes = Detail::makeSizesArray(arg0, args...);
+    const size_t totalSize = Detail::totalSizeHelper(sizes) + delimiterSize * (argCount - 1);
+    std::string result(totalSize, char{}); // note: initialization and memcpy is faster than reserve and +=
+    char* copyDestination = &result[0];
+    Detail::copyToString(std::forward<Arg0>(arg0), sizes[0], copyDestination);
+    size_t index = 1;
+    copyDestination += sizes[0];
+    ((
+         Detail::copyToString(delimiter, delimiterSize, copyDestination),
+         Detail::copyToString(args, sizes[index], copyDestination + delimiterSize),
+         copyDestination += delimiterSize + sizes[index++]),
+        ...);
+    return result;
+}
+
+
+template<typename Delimiter, typename... Args>
+static inline std::string joinOptional(const Delimiter& delimiter, Args&&... args)
+{
+    constexpr size_t argCount = sizeof...(args);
+    if constexpr (argCount == 0)
+    {
+        return std::string();
+    }
+    if constexpr (argCount == 1) // we only have one argument so we can return it
+    {
+        return Detail::makeString(std::forward<Args>(args)...);
+    }
+    const size_t delimiterSize = Detail::getStringSize(delimiter);
+    const auto sizes = Detail::makeSizesArray(args...);
+    const size_t validArgumentCount = Detail::joinOptionalArgumentCount(args...);
+    const size_t delimiterCount = (validArgumentCount != 0) ? validArgumentCount - 1 : 0;
+    const size_t totalSize = Detail::totalSizeHelper(sizes) + delimiterSize * delimiterCount;
+    std::string result(totalSize, char{}); // note: initialization and memcpy is faster than reserve and +=
+    char* copyDestination = &result[0];
+    bool isFirst = true;
+    size_t index = 0;
+    ((
+         isFirst = Detail::joinOptionalCopyHelper(isFirst, args, sizes[index], delimiter, delimiterSize, copyDestination),
+         ++index),
+        ...);
+    return result;
+}
+
+
+template<typename... Args>
+static inline std::string concat(Args&&... args)
+{
+    constexpr size_t argCount = sizeof...(args);
+    if constexpr (argCount == 0)
+    { // we only have one argument so we can return it
+        return std::string();
+    }
+    if constexpr (argCount == 1)
+    { // we only have one argument so we can return it
+        return Detail::makeString(std::forward<Args>(args)...);
+    }
+    const auto sizes = Detail::makeSizesArray(args...);
+    const size_t totalSize = Detail::totalSizeHelper(sizes);
+    std::string result(totalSize, char{}); // note: initialization and memcpy is faster than reserve and +=
+    char* copyDestination = &result[0];
+    size_t index = 0;
+    ((
+         Detail::copyToString(args, sizes[index], copyDestination),
+         copyDestination += sizes[index++]),
+        ...);
+    return result;
+}
+
+
+template<class StringOrStringView, typename std::enable_if<std::is_same<StringOrStringView, std::string>::value, bool>::type = true>
+inline void assign(StringOrStringView& str, const char* ptr, const size_t size)
+{
+    str.assign(ptr, size);
+}
+template<class StringOrStringView, typename std::enable_if<std::is_same<StringOrStringView, std::string_view>::value, bool>::type = true>
+constexpr inline void assign(StringOrStringView& str, const char* ptr, const size_t size)
+{
+    str = std::string_view(ptr, size);
+}
+
+
+template<class StringOrStringView, class StringView, typename std::enable_if<std::is_same<StringOrStringView, StringView>::value, bool>::type = true>
+inline std::vector<StringView> splitNoSeparator(StringView source)
+{
+    const size_t sourceLength = source.length();
+    std::vector<StringView> list(sourceLength + 1);
+    for (size_t j = 0; j < sourceLength; ++j)
+    {
+        list[j + 1] = StringView(source.data() + j, 1);
+    }
+    return list;
+}
+
+template<class StringOrStringView, class StringView, typename std::enable_if<std::is_same<StringOrStringView, StringView>::value, bool>::type = true>
+inline std::vector<StringView> splitNoSeparator(StringView source, size_t maxSplits)
+{
+    const size_t sourceLength = source.length();
+    maxSplits = std::min(maxSplits, sourceLength);
+    if (maxSplits == 0)
+    {
+        return std::vector<StringView>(1, source);
+    }
+
+    std::vector<StringOrStringView> list(maxSplits + 1);
+    list[0] = StringOrStringView(source.data(), 0); // we want this empty string_view be in range of source
+    for (size_t j = 0; j < maxSplits - 1; ++j)
+    {
+        list[j + 1] = StringView(source.data() + j, 1);
+    }
+    list[maxSplits] = StringView(source.data() + maxSplits - 1, sourceLength + 1 - maxSplits);
+    return list;
+}
+
+template<class StringOrStringView, class StringView, typename std::enable_if<std::is_same<StringOrStringView, std::string>::value, bool>::type = true>
+inline std::vector<std::string> splitNoSeparator(StringView source)
+{
+    const size_t sourceLength = source.length();
+    std::vector<std::string> list(sourceLength + 1, std::string(1, '?'));
+    list[0].clear();
+    for (size_t j = 0; j < sourceLength; ++j)
+    {
+        list[j + 1][0] = source[j];
+    }
+    return list;
+}
+
+template<class StringOrStringView, class StringView, typename std::enable_if<std::is_same<StringOrStringView, std::string>::value, bool>::type = true>
+inline std::vector<std::string> splitNoSeparator(StringView source, size_t maxSplits)
+{
+    const size_t sourceLength = source.length();
+    maxSplits = std::min(maxSplits, sourceLength);
+    if (maxSplits == 0)
+    {
+        return constructSingleElementVector<std::string>(source);
+    }
+    std::vector<std::string> list(maxSplits + 1, std::string(1, '?'));
+    list[0].clear();
+    for (size_t j = 0; j < maxSplits - 1; ++j)
+    {
+        list[j + 1][0] = source[j];
+    }
+    list[maxSplits].assign(source.data() + maxSplits - 1, sourceLength + 1 - maxSplits);
+    return list;
+}
+
+
+template<class StringOrStringView, class StringView, size_t maxSplits, typename std::enable_if<std::is_same<StringOrStringView, StringView>::value, bool>::type = true>
+constexpr inline STRINGUTILS_NAMESPACE::SplitResult<StringOrStringView, maxSplits> splitNoSeparator(StringView source)
+{
+    STRINGUTILS_NAMESPACE::SplitResult<StringOrStringView, maxSplits> result;
+    const size_t sourceLength = source.length();
+    const size_t totalSplits = std::min(maxSplits, sourceLength);
+    result.size = totalSplits + 1;
+    if (totalSplits == 0)
+    {
+        result.parts[0] = source;
+        return result;
+    }
+
+    result.parts[0] = StringView(source.data(), 0); // we want first empty string_view be in range of source
+    for (size_t j = 0; j < totalSplits - 1; ++j)
+    {
+        result.parts[j + 1] = StringView(source.data() + j, 1);
+    }
+    result.parts[totalSplits] = StringView(source.data() + totalSplits - 1, sourceLength + 1 - totalSplits);
+    return result;
+}
+
+template<class StringOrStringView, class StringView, size_t maxSplits, typename std::enable_if<std::is_same<StringOrStringView, std::string>::value, bool>::type = true>
+inline STRINGUTILS_NAMESPACE::SplitResult<StringOrStringView, maxSplits> splitNoSeparator(StringView source)
+{
+    STRINGUTILS_NAMESPACE::SplitResult<StringOrStringView, maxSplits> result;
+    const size_t sourceLength = source.length();
+    const size_t totalSplits = std::min(maxSplits, sourceLength);
+    result.size = totalSplits + 1;
+    if (totalSplits == 0)
+    {
+        result.parts[0].assign(source.data(), source.size());
+        return result;
+    }
+    for (size_t j = 0; j < totalSplits - 1; ++j)
+    {
+        result.parts[j + 1].assign(source.data() + j, 1);
+    }
+    result.parts[totalSplits].assign(source.data() + totalSplits - 1, sourceLength + 1 - totalSplits);
+    return result;
+}
+
+
+template<class StringOrStringView, class StringView, typename std::enable_if<std::is_same<StringOrStringView, StringView>::value, bool>::type = true>
+inline std::vector<StringView> splitNoSeparatorSkipEmpty(StringView source)
+{
+    const size_t sourceLength = source.length();
+    std::vector<StringView> list(sourceLength);
+    for (size_t j = 0; j < sourceLength; ++j)
+    {
+        list[j] = StringView(source.data() + j, 1);
+    }
+    return list;
+}
+
+template<class StringOrStringView, class StringView, typename std::enable_if<std::is_same<StringOrStringView, StringView>::value, bool>::type = true>
+inline std::vector<StringView> splitNoSeparatorSkipEmpty(StringView source, size_t maxSplits)
+{
+    const size_t sourceLength = source.length();
+    maxSplits = std::min(sourceLength, maxSplits);
+    if (maxSplits == 0)
+    {
+        return std::vector<StringView>(sourceLength != 0 ? 1 : 0, source);
+    }
+    std::vector<StringView> list(maxSplits);
+    for (size_t j = 0; j < maxSplits - 1; ++j)
+    {
+        list[j] = StringView(source.data() + j, 1);
+    }
+    list[maxSplits - 1] = StringView(source.data() + maxSplits - 1, sourceLength + 1 - maxSplits);
+    return list;
+}
+
+template<class StringOrStringView, class StringView, typename std::enable_if<std::is_same<StringOrStringView, std::string>::value, bool>::type = true>
+inline std::vector<StringOrStringView> splitNoSeparatorSkipEmpty(StringView source)
+{
+    const size_t sourceLength = source.length();
+    std::vector<StringOrStringView> list(sourceLength, std::string(1, '?'));
+    for (size_t j = 0; j < sourceLength; ++j)
+    {
+        list[j][0] = source[j];
+    }
+    return list;
+}
+
+template<class StringOrStringView, class StringView, typename std::enable_if<std::is_same<StringOrStringView, std::string>::value, bool>::type = true>
+inline std::vector<StringOrStringView> splitNoSeparatorSkipEmpty(StringView source, size_t maxSplits)
+{
+    const size_t sourceLength = source.length();
+    maxSplits = std::min(sourceLength, maxSplits);
+    if (maxSplits == 0)
+    {
+        return (sourceLength != 0) ? constructSingleElementVector<std::string>(source) : std::vector<StringOrStringView>();
+    }
+
+    std::vector<StringOrStringView> list(maxSplits, std::string(1, '?'));
+    for (size_t j = 0; j < maxSplits - 1; ++j)
+    {
+        list[j][0] = source[j];
+    }
+    list[maxSplits - 1].assign(source.data() + maxSplits - 1, sourceLength + 1 - maxSplits);
+    return list;
+}
+
+
+template<class StringOrStringView, class StringView, size_t maxSplits, typename std::enable_if<std::is_same<StringOrStringView, StringView>::value, bool>::type = true>
+constexpr inline STRINGUTILS_NAMESPACE::SplitResult<StringOrStringView, maxSplits> splitNoSeparatorSkipEmpty(StringView source)
+{
+    STRINGUTILS_NAMESPACE::SplitResult<StringOrStringView, maxSplits> result;
+    const size_t sourceLength = source.length();
+    const size_t totalSplits = std::min(maxSplits, sourceLength);
+    result.size = totalSplits;
+    if (totalSplits == 0)
+    {
+        result.parts[0] = source;
+        return result;
+    }
+
+    for (size_t j = 0; j < totalSplits - 1; ++j)
+    {
+        result.parts[j] = StringView(source.data() + j, 1);
+    }
+    result.parts[totalSplits - 1] = StringView(source.data() + totalSplits - 1, sourceLength + 1 - totalSplits);
+    return result;
+}
+
+template<class StringOrStringView, class StringView, size_t maxSplits, typename std::enable_if<std::is_same<StringOrStringView, std::string>::value, bool>::type = true>
+inline STRINGUTILS_NAMESPACE::SplitResult<StringOrStringView, maxSplits> splitNoSeparatorSkipEmpty(StringView source)
+{
+    STRINGUTILS_NAMESPACE::SplitResult<StringOrStringView, maxSplits> result;
+    const size_t sourceLength = source.length();
+    const size_t totalSplits = std::min(maxSplits, sourceLength);
+    result.size = totalSplits + 1;
+    if (totalSplits == 0)
+    {
+        result.parts[0].assign(source.data(), source.size());
+        return result;
+    }
+    for (size_t j = 0; j < totalSplits - 1; ++j)
+    {
+        result.parts[j].assign(source.data() + j, 1);
+    }
+    result.parts[totalSplits].assign(source.data() + totalSplits - 1, sourceLength + 1 - totalSplits);
+    return result;
+}
+
+
+/**
+* Splits source at the indices reported by forEachSeparator(visitor), at most maxSplits times, and calls emit(ptr, size) for each part
+* With skipEmpty the empty parts are not emitted, they still count as splits like in the find based loops
+*/
+template<bool skipEmpty, class ForEachSeparator, class Emit>
+inline void splitAtIndices(const std::string_view source, const size_t maxSplits, ForEachSeparator&& forEachSeparator, Emit&& emit)
+{
+    size_t start = 0;
+    if (maxSplits != 0)
+    {
+        size_t splits = 0;
+        auto visitor = [&](const size_t index) {
+            if (!skipEmpty || index != start)
+            {
+                emit(source.data() + start, index - start);
+            }
+            start = index + 1;
+            return ++splits < maxSplits;
+        };
+        forEachSeparator(visitor);
+    }
+    if (!skipEmpty || start != source.size())
+    {
+        emit(source.data() + start, source.size() - start);
+    }
+}
+
+/**
+* The single char and char set splits scan 64 char blocks for all separators at once (see forEachChar) instead of searching once per part
+*/
+template<bool skipEmpty, class Emit>
+inline void splitAtSeparators(const std::string_view source, const char separator, const size_t maxSplits, Emit&& emit)
+{
+    splitAtIndices<skipEmpty>(
+        source, maxSplits, [source, separator](auto& visitor) { forEachChar(source.data(), source.size(), separator, visitor); }, emit);
+}
+
+template<bool skipEmpty, bool negate, class Emit>
+inline void splitAtSeparators(const std::string_view source, const CharSet& separators, const size_t maxSplits, Emit&& emit)
+{
+    splitAtIndices<skipEmpty>(
+        source, maxSplits, [source, &separators](auto& visitor) { forEachCharClass<negate>(source.data(), source.size(), separators, visitor); }, emit);
+}
+
+
+template<class StringOrStringView, class StringView>
+[[nodiscard]] inline std::vector<StringOrStringView> split(StringView source, const StringView separator)
+{
+    const size_t separatorSize = separator.size();
+    LazyTwoWay<false> twoWay;
+    if (separatorSize == 0)
+    {
+        return Detail::splitNoSeparator<StringOrStringView>(source);
+    }
+    std::vector<StringOrStringView> list;
+    for (;;)
+    {
+        const size_t end = Detail::find(source.data(), source.size(), 0, separator.data(), separatorSize, twoWay);
+        if (end == INDEX_NOT_FOUND)
+        {
+            break;
+        }
+
+        list.emplace_back(source.data(), end);
+        source.remove_prefix(end + separatorSize);
+    }
+    list.emplace_back(source.data(), source.size());
+    return list;
+}
+
+
+template<class StringOrStringView, class StringView>
+[[nodiscard]] inline std::vector<StringOrStringView> split(StringView source, const char separator)
+{
+    std::vector<StringOrStringView> list;
+    splitAtSeparators<false>(source, separator, INDEX_NOT_FOUND, [&list](const char* const ptr, const size_t size) { list.emplace_back(ptr, size); });
+    return list;
+}
+
+
+template<class StringOrStringView, class StringView>
+[[nodiscard]] inline std::vector<StringOrStringView> split(StringView source, const StringView separator, const size_t maxSplits)
+{
+    const size_t separatorSize = separator.size();
+    LazyTwoWay<false> twoWay;
+    if (separatorSize == 0)
+    {
+        return Detail::splitNoSeparator<StringOrStringView>(source, maxSplits);
+    }
+    std::vector<StringOrStringView> list;
+
+    for (size_t splits = 0; splits < maxSplits; ++splits)
+    {
+        const size_t end = Detail::find(source.data(), source.size(), 0, separator.data(), separatorSize, twoWay);
+        if (end == INDEX_NOT_FOUND)
+        {
+            break;
+        }
+
+        list.emplace_back(source.data(), end);
+        source.remove_prefix(end + separatorSize);
+    }
+    list.emplace_back(source.data(), source.size());
+    return list;
+}
+
+template<class StringOrStringView, class StringView>
+[[nodiscard]] inline std::vector<StringOrStringView> split(StringView source, const char separator, const size_t maxSplits)
+{
+    std::vector<StringOrStringView> list;
+    splitAtSeparators<false>(source, separator, maxSplits, [&list](const char* const ptr, const size_t size) { list.emplace_back(ptr, size); });
+    return list;
+}
+
+
+template<class StringOrStringView, class StringView, size_t maxSplits>
+[[nodiscard]] inline STRINGUTILS_NAMESPACE::SplitResult<StringOrStringView, maxSplits> split(StringView source, const StringView separator)
+{
+    const size_t separatorSize = separator.size();
+    LazyTwoWay<false> twoWay;
+    if (separatorSize == 0)
+    {
+        return Detail::splitNoSeparator<StringOrStringView, maxSplits>(source);
+    }
+    STRINGUTILS_NAMESPACE::SplitResult<StringOrStringView, maxSplits> result;
+    size_t splits = 0;
+
+    for (; splits < maxSplits; ++splits)
+    {
+        const size_t end = Detail::find(source.data(), source.size(), 0, separator.data(), separatorSize, twoWay);
+        if (end == INDEX_NOT_FOUND)
+        {
+            break;
+        }
+
+        assign(result.parts[splits], source.data(), end);
+        source.remove_prefix(end + separatorSize);
+    }
+    assign(result.parts[splits], source.data(), source.size());
+    result.size = splits + 1;
+    return result;
+}
+
+
+template<class StringOrStringView, class StringView, size_t maxSplits>
+[[nodiscard]] inline STRINGUTILS_NAMESPACE::SplitResult<StringOrStringView, maxSplits> split(StringView source, const char separator)
+{
+    STRINGUTILS_NAMESPACE::SplitResult<StringOrStringView, maxSplits> result;
+    size_t position = 0;
+    splitAtSeparators<false>(source, separator, maxSplits, [&result, &position](const char* const ptr, const size_t size) { assign(result.parts[position++], ptr, size); });
+    result.size = position;
+    return result;
+}
+
+
+template<class StringOrStringView, class StringView>
+[[nodiscard]] inline std::vector<StringOrStringView> splitAnyOf(StringView source, const CharSet& separators)
+{
+    std::vector<StringOrStringView> list;
+    splitAtSeparators<false, false>(source, separators, INDEX_NOT_FOUND, [&list](const char* const ptr, const size_t size) { list.emplace_back(ptr, size); });
+    return list;
+}
+
+template<class StringOrStringView, class StringView>
+[[nodiscard]] inline std::vector<StringOrStringView> splitAnyOf(StringView source, const CharSet& separators, const size_t maxSplits)
+{
+    std::vector<StringOrStringView> list;
+    splitAtSeparators<false, false>(source, separators, maxSplits, [&list](const char* const ptr, const size_t size) { list.emplace_back(ptr, size); });
+    return list;
+}
+
+
+template<class StringOrStringView, class StringView, size_t maxSplits>
+[[nodiscard]] inline STRINGUTILS_NAMESPACE::SplitResult<StringOrStringView, maxSplits> splitAnyOf(StringView source, const CharSet& separators)
+{
+    STRINGUTILS_NAMESPACE::SplitResult<StringOrStringView, maxSplits> result;
+    size_t position = 0;
+    splitAtSeparators<false, false>(source, separators, maxSplits, [&result, &position](const char* const ptr, const size_t size) { assign(result.parts[position++], ptr, size); });
+    result.size = position;
+    return result;
+}
+
+
+template<class StringOrStringView, class StringView>
+[[nodiscard]] inline std::vector<StringOrStringView> splitAnyBut(StringView source, const CharSet& separators)
+{
+    std::vector<StringOrStringView> list;
+    splitAtSeparators<false, true>(source, separators, INDEX_NOT_FOUND, [&list](const char* const ptr, const size_t size) { list.emplace_back(ptr, size); });
+    return list;
+}
+
+template<class StringOrStringView, class StringView>
+[[nodiscard]] inline std::vector<StringOrStringView> splitAnyBut(StringView source, const CharSet& separators, const size_t maxSplits)
+{
+    std::vector<StringOrStringView> list;
+    splitAtSeparators<false, true>(source, separators, maxSplits, [&list](const char* const ptr, const size_t size) { list.emplace_back(ptr, size); });
+    return list;
+}
+
+
+template<class StringOrStringView, class StringView, size_t maxSplits>
+[[nodiscard]] inline STRINGUTILS_NAMESPACE::SplitResult<StringOrStringView, maxSplits> splitAnyBut(StringView source, const CharSet& separators)
+{
+    STRINGUTILS_NAMESPACE::SplitResult<StringOrStringView, maxSplits> result;
+    size_t position = 0;
+    splitAtSeparators<false, true>(source, separators, maxSplits, [&result, &position](const char* const ptr, const size_t size) { assign(result.parts[position++], ptr, size); });
+    result.size = position;
+    return result;
+}
+
+
+template<class StringOrStringView, class StringView>
+[[nodiscard]] inline std::vector<StringOrStringView> splitSkipEmpty(StringView source, const StringView separator)
+{
+    const size_t separatorSize = separator.size();
+    LazyTwoWay<false> twoWay;
+    if (separatorSize == 0)
+    {
+        return Detail::splitNoSeparatorSkipEmpty<StringOrStringView>(source);
+    }
+    std::vector<StringOrStringView> list;
+    for (;;)
+    {
+        const size_t end = Detail::find(source.data(), source.size(), 0, separator.data(), separatorSize, twoWay);
+        if (end == INDEX_NOT_FOUND)
+        {
+            break;
+        }
+
+        if (end != 0)
+        {
+            list.emplace_back(source.data(), end);
+        }
+        source.remove_prefix(end + separatorSize);
+    }
+    if (!source.empty())
+    {
+        list.emplace_back(source.data(), source.size());
+    }
+    return list;
+}
+
+template<class StringOrStringView, class StringView>
+[[nodiscard]] inline std::vector<StringOrStringView> splitSkipEmpty(StringView source, const char separator)
+{
+    std::vector<StringOrStringView> list;
+    splitAtSeparators<true>(source, separator, INDEX_NOT_FOUND, [&list](const char* const ptr, const size_t size) { list.emplace_back(ptr, size); });
+    return list;
+}
+
+
+template<class StringOrStringView, class StringView>
+[[nodiscard]] inline std::vector<StringOrStringView> splitSkipEmpty(StringView source, const StringView separator, const size_t maxSplits)
+{
+    const size_t separatorSize = separator.size();
+    LazyTwoWay<false> twoWay;
+    if (separatorSize == 0)
+    {
+        return Detail::splitNoSeparatorSkipEmpty<StringOrStringView>(source, maxSplits);
+    }
+    std::vector<StringOrStringView> list;
+    for (size_t splits = 0; splits < maxSplits; ++splits)
+    {
+        const size_t end = Detail::find(source.data(), source.size(), 0, separator.data(), separatorSize, twoWay);
+        if (end == INDEX_NOT_FOUND)
+        {
+            break;
+        }
+
+        if (end != 0)
+        {
+            list.emplace_back(source.data(), end);
+        }
+        source.remove_prefix(end + separatorSize);
+    }
+    if (!source.empty())
+    {
+        list.emplace_back(source.data(), source.size());
+    }
+    return list;
+}
+
+template<class StringOrStringView, class StringView>
+[[nodiscard]] inline std::vector<StringOrStringView> splitSkipEmpty(StringView source, const char separator, const size_t maxSplits)
+{
+    std::vector<StringOrStringView> list;
+    splitAtSeparators<true>(source, separator, maxSplits, [&list](const char* const ptr, const size_t size) { list.emplace_back(ptr, size); });
+    return list;
+}
+
+template<class StringOrStringView, class StringView, size_t maxSplits>
+[[nodiscard]] inline STRINGUTILS_NAMESPACE::SplitResult<StringOrStringView, maxSplits> splitSkipEmpty(StringView source, const StringView separator)
+{
+    const size_t separatorSize = separator.size();
+    LazyTwoWay<false> twoWay;
+    if (separatorSize == 0)
+    {
+        return Detail::splitNoSeparatorSkipEmpty<StringOrStringView, maxSplits>(source);
+    }
+
+    STRINGUTILS_NAMESPACE::SplitResult<StringOrStringView, maxSplits> result;
+    size_t position = 0;
+    for (size_t splits = 0; splits < maxSplits; ++splits)
+    {
+        const size_t end = Detail::find(source.data(), source.size(), 0, separator.data(), separatorSize, twoWay);
+        if (end == INDEX_NOT_FOUND)
+        {
+            break;
+        }
+        if (end != 0)
+        {
+            assign(result.parts[position++], source.data(), end);
+        }
+        source.remove_prefix(end + separatorSize);
+    }
+    if (!source.empty())
+    {
+        assign(result.parts[position++], source.data(), source.size());
+    }
+    result.size = position;
+    return result;
+}
+
+template<class StringOrStringView, class StringView, size_t maxSplits>
+[[nodiscard]] inline STRINGUTILS_NAMESPACE::SplitResult<StringOrStringView, maxSplits> splitSkipEmpty(StringView source, const char separator)
+{
+    STRINGUTILS_NAMESPACE::SplitResult<StringOrStringView, maxSplits> result;
+    size_t position = 0;
+    splitAtSeparators<true>(source, separator, maxSplits, [&result, &position](const char* const ptr, const size_t size) { assign(result.parts[position++], ptr, size); });
+    result.size = position;
+    return result;
+}
+
+
+template<class StringOrStringView, class StringView>
+[[nodiscard]] inline std::vector<StringOrStringView> splitAnyOfSkipEmpty(StringView source, const CharSet& separators)
+{
+    std::vector<StringOrStringView> list;
+    splitAtSeparators<true, false>(source, separators, INDEX_NOT_FOUND, [&list](const char* const ptr, const size_t size) { list.emplace_back(ptr, size); });
+    return list;
+}
+
+
+template<class StringOrStringView, class StringView>
+[[nodiscard]] inline std::vector<StringOrStringView> splitAnyOfSkipEmpty(StringView source, const CharSet& separators, const size_t maxSplits)
+{
+    std::vector<StringOrStringView> list;
+    splitAtSeparators<true, false>(source, separators, maxSplits, [&list](const char* const ptr, const size_t size) { list.emplace_back(ptr, size); });
+    return list;
+}
+
+
+template<class StringOrStringView, class StringView, size_t maxSplits>
+[[nodiscard]] inline STRINGUTILS_NAMESPACE::SplitResult<StringOrStringView, maxSplits> splitAnyOfSkipEmpty(StringView source, const CharSet& separators)
+{
+    STRINGUTILS_NAMESPACE::SplitResult<StringOrStringView, maxSplits> result;
+    size_t position = 0;
+    splitAtSeparators<true, false>(source, separators, maxSplits, [&result, &position](const char* const ptr, const size_t size) { assign(result.parts[position++], ptr, size); });
+    result.size = position;
+    return result;
+}
+
+
+template<class StringOrStringView, class StringView>
+[[nodiscard]] inline std::vector<StringOrStringView> splitAnyButSkipEmpty(StringView source, const CharSet& separators)
+{
+    std::vector<StringOrStringView> list;
+    splitAtSeparators<true, true>(source, separators, INDEX_NOT_FOUND, [&list](const char* const ptr, const size_t size) { list.emplace_back(ptr, size); });
+    return list;
+}
+
+template<class StringOrStringView, class StringView>
+[[nodiscard]] inline std::vector<StringOrStringView> splitAnyButSkipEmpty(StringView source, const CharSet& separators, const size_t maxSplits)
+{
+    std::vector<StringOrStringView> list;
+    splitAtSeparators<true, true>(source, separators, maxSplits, [&list](const char* const ptr, const size_t size) { list.emplace_back(ptr, size); });
+    return list;
+}
+
+template<class StringOrStringView, class StringView, size_t maxSplits>
+[[nodiscard]] inline STRINGUTILS_NAMESPACE::SplitResult<StringOrStringView, maxSplits> splitAnyButSkipEmpty(StringView source, const CharSet& separators)
+{
+    STRINGUTILS_NAMESPACE::SplitResult<StringOrStringView, maxSplits> result;
+    size_t position = 0;
+    splitAtSeparators<true, true>(source, separators, maxSplits, [&result, &position](const char* const ptr, const size_t size) { assign(result.parts[position++], ptr, size); });
+    result.size = position;
+    return result;
+}
+
+
+} // namespace Detail
+
+
+//#######################################################################################
+//
+//                                      Split quoted
+//
+//#######################################################################################
+
+
+namespace Detail {
+/**
+* Calls visitor(index) for every separator in [source, source + size) outside of quotes that is not escaped, in order, until it returns false
+* Quotes toggle the quoted state, so a doubled quote inside quotes ("a""b") leaves and reenters it
+* escape makes the next char literal (also outside of quotes), it has no special meaning if it equals quote
+*/
+template<class Visitor>
+inline void forEachUnquoted(const char* const source, const size_t size, const char separator, const char quote, const char escape, Visitor& visitor)
+{
+#if STRINGUTILS_HAS_SIMD
+    Simd::Dispatch::forEachUnquoted(source, size, separator, quote, escape, visitor);
+#else
+    bool inside = false;
+    for (size_t index = 0; index < size; ++index)
+    {
+        const char c = source[index];
+        if (c == escape && escape != quote)
+        {
+            ++index;
+        }
+        else if (c == quote)
+        {
+            inside = !inside;
+        }
+        else if (c == separator && !inside && !visitor(index))
+        {
+            return;
+        }
+    }
+#endif
+}
+
+/**
+* Writes field without its quotes and escapes to destination (at least field.size() chars) and returns the size written
+*/
+inline size_t unescapeField(const std::string_view field, const char quote, const char escape, char* const destination) noexcept
+{
+    size_t size = 0;
+    bool inside = false;
+    for (size_t index = 0; index < field.size(); ++index)
+    {
+        const char c = field[index];
+        if (c == escape && escape != quote && index + 1 < field.size())
+        {
+            destination[size++] = field[++index];
+        }
+        else if (c == quote)
+        {
+            if (inside && escape == quote && index + 1 < field.size() && field[index + 1] == quote)
+            { // a doubled quote inside quotes is one literal quote
+                destination[size++] = quote;
+                ++index;
+            }
+            else
+            {
+                inside = !inside;
+            }
+        }
+        else
+        {
+            destination[size++] = c;
+        }
+    }
+    return size;
+}
+
+inline std::vector<std::string_view> splitQuoted(const std::string_view source, const char separator, const char quote, const char escape)
+{
+    std::vector<std::string_view> fields;
+    splitAtIndices<false>(
+        source, INDEX_NOT_FOUND, [&](auto& visitor) { forEachUnquoted(source.data(), source.size(), separator, quote, escape, visitor); },
+        [&fields](const char* const ptr, const size_t size) { fields.emplace_back(ptr, size); });
+    return fields;
+}
+
+/**
+* The fields without quote and escape chars stay views into source, the others are unescaped into buffer
+* buffer is sized for the worst case up front, so it is not reallocated while the views into it are taken
+*/
+inline std::vector<std::string_view> splitQuotedUnescaped(const std::string_view source, std::string& buffer, const char separator, const char quote, const char escape)
+{
+    std::vector<std::string_view> fields = splitQuoted(source, separator, quote, escape);
+    const auto needsUnescape = [quote, escape](const std::string_view field) {
+        return field.find(quote) != INDEX_NOT_FOUND || (escape != quote && field.find(escape) != INDEX_NOT_FOUND);
+    };
+    size_t bufferSize = 0;
+    for (const std::string_view field : fields)
+    {
+        bufferSize += needsUnescape(field) ? field.size() : 0;
+    }
+    buffer.resize(bufferSize);
+    size_t position = 0;
+    for (std::string_view& field : fields)
+    {
+        if (needsUnescape(field))
+        {
+            const size_t size = unescapeField(field, quote, escape, &buffer[position]);
+            field = std::string_view(buffer.data() + position, size);
+            position += size;
+        }
+    }
+    buffer.resize(position);
+    return fields;
+}
+} // namespace Detail
+
+
+//#######################################################################################
+//
+//                                      SplitView
+//
+//#######################################################################################
+
+
+namespace Detail {
+/**
+* Separators of the lazy split ranges, find returns the index of the next separator in source or INDEX_NOT_FOUND
+* splits is the number of splits done so far, the empty string separator needs it for the leading empty part
+*/
+struct CharSeparator
+{
+    char separator = '\0';
+
+    constexpr size_t find(const std::string_view source, const size_t /*splits*/) const noexcept
+    {
+        return Detail::find(source.data(), source.size(), 0, separator);
+    }
+
+    constexpr size_t size() const noexcept
+    {
+        return 1;
+    }
+};
+
+struct StringSeparator
+{
+    std::string_view separator;
+    mutable LazyTwoWay<false> twoWay; // shared by the finds of one iteration
+
+    constexpr size_t find(const std::string_view source, const size_t splits) const noexcept
+    {
+        if (separator.empty())
+        {
+            return findNoSeparator(source, splits);
+        }
+        return Detail::find(source.data(), source.size(), 0, separator.data(), separator.size(), twoWay);
+    }
+
+    constexpr size_t size() const noexcept
+    {
+        return separator.size();
+    }
+
+    /**
+    * An empty separator splits in front of every char like splitNoSeparator, "abc" => ["", "a", "b", "c"]
+    */
+    static constexpr size_t findNoSeparator(const std::string_view source, const size_t splits) noexcept
+    {
+        const size_t end = (splits == 0) ? 0 : 1;
+        return (end < source.size()) ? end : INDEX_NOT_FOUND;
+    }
+};
+
+template<class Searcher>
+struct SearcherSeparator
+{
+    const Searcher* searcher = nullptr;
+
+    constexpr size_t find(const std::string_view source, const size_t splits) const noexcept
+    {
+        return searcher->needle().empty() ? StringSeparator::findNoSeparator(source, splits) : searcher->find(source, 0);
+    }
+
+    constexpr size_t size() const noexcept
+    {
+        return searcher->needle().size();
+    }
+};
+
+template<bool negate>
+struct CharSetSeparator
+{
+    CharSet separators;
+
+    constexpr size_t find(const std::string_view source, const size_t /*splits*/) const noexcept
+    {
+        return negate ? Detail::findAnyBut(source.data(), source.size(), 0, separators) : Detail::findAnyOf(source.data(), source.size(), 0, separators);
+    }
+
+    constexpr size_t size() const noexcept
+    {
+        return 1;
+    }
+};
+} // namespace Detail
+
+
+template<class Separator, bool skipEmpty>
+class SplitView
+{ // the iterators carry a copy of the separator, so they stay valid when the view is gone
+  private:
+    std::string_view m_Source;
+    Separator m_Separator;
+    size_t m_MaxSplits = INDEX_NOT_FOUND;
+    bool m_HasParts = true; // false for none(), splitting an empty source still gives one empty part
+
+  public:
+    class iterator
+    {
+      public:
+        using iterator_category = std::input_iterator_tag; // operator* returns by value, which a LegacyForwardIterator may not
+        using iterator_concept = std::forward_iterator_tag; // C++20 allows a forward iterator to do so
+        using value_type = std::string_view;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = std::string_view;
+
+      private:
+        std::string_view m_Part;
+        std::string_view m_Rest;
+        Separator m_Separator;
+        size_t m_MaxSplits = 0;
+        size_t m_Splits = 0;
+        bool m_LastPart = true; // m_Rest was handed out as the last part
+        bool m_AtEnd = true;
+
+        friend class SplitView;
+
+        constexpr iterator(const std::string_view source, const Separator& separator, const size_t maxSplits) noexcept
+            : m_Rest(source)
+            , m_Separator(separator)
+            , m_MaxSplits(maxSplits)
+            , m_LastPart(false)
+            , m_AtEnd(false)
+        {
+            next();
+        }
+
+        constexpr void next() noexcept
+        {
+            while (!m_LastPart)
+            {
+                const size_t end = (m_Splits < m_MaxSplits) ? m_Separator.find(m_Rest, m_Splits) : INDEX_NOT_FOUND;
+                if (end == INDEX_NOT_FOUND)
+                {
+                    m_Part = m_Rest;
+                    m_LastPart = true;
+                }
+                else
+                {
+                    m_Part = std::string_view(m_Rest.data(), end);
+                    m_Rest.remove_prefix(end + m_Separator.size());
+                    ++m_Splits;
+                }
+                if (!skipEmpty || !m_Part.empty())
+                {
+                    return;
+                }
+            }
+            m_AtEnd = true;
+        }
+
+      public:
+        constexpr iterator() noexcept = default;
+
+        [[nodiscard]] constexpr reference operator*() const noexcept
+        {
+            return m_Part;
+        }
+
+        constexpr iterator& operator++() noexcept
+        {
+            next();
+            return *this;
+        }
+
+        constexpr iterator operator++(int) noexcept
+        {
+            iterator copy = *this;
+            next();
+            return copy;
+        }
+
+        [[nodiscard]] friend constexpr bool operator==(const iterator& lhs, const iterator& rhs) noexcept
+        {
+            return lhs.m_AtEnd == rhs.m_AtEnd && (lhs.m_AtEnd || (lhs.m_Part.data() == rhs.m_Part.data() && lhs.m_Part.size() == rhs.m_Part.size()));
+        }
+
+        [[nodiscard]] friend constexpr bool operator!=(const iterator& lhs, const iterator& rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+    };
+
+    using const_iterator = iterator;
+
+    constexpr SplitView() noexcept = default;
+
+    constexpr SplitView(const std::string_view source, const Separator& separator, const size_t maxSplits) noexcept
+        : m_Source(source)
+        , m_Separator(separator)
+        , m_MaxSplits(maxSplits)
+    {
+    }
+
+    /**
+    * A view without any parts
+    */
+    [[nodiscard]] static constexpr SplitView none() noexcept
+    {
+        SplitView view;
+        view.m_HasParts = false;
+        return view;
+    }
+
+    [[nodiscard]] constexpr iterator begin() const noexcept
+    {
+        return m_HasParts ? iterator(m_Source, m_Separator, m_MaxSplits) : iterator();
+    }
+
+    [[nodiscard]] constexpr iterator end() const noexcept
+    {
+        return iterator();
+    }
+};
+} // namespace STRINGUTILS_NAMESPACE
+
+
+#if defined(__cpp_lib_ranges)
+namespace std::ranges {
+template<class Separator, bool skipEmpty>
+inline constexpr bool enable_view<STRINGUTILS_NAMESPACE::SplitView<Separator, skipEmpty>> = true;
+
+template<class Separator, bool skipEmpty>
+inline constexpr bool enable_borrowed_range<STRINGUTILS_NAMESPACE::SplitView<Separator, skipEmpty>> = true;
+} // namespace std::ranges
+#endif
+
+
+namespace STRINGUTILS_NAMESPACE {
+
+
+//#######################################################################################
+//
+//                                      TokenIndex
+//
+//#######################################################################################
+
+
+class TokenIndex
+{ // token i is [tokenEnd(i - 1) + separator size, tokenEnd(i)), only the ends are stored, 2 bytes wide if the source allows it, else 4 or 8
+  private:
+    const char* m_Source = nullptr;
+    size_t m_SourceSize = 0;
+    size_t m_SeparatorSize = 0;
+    size_t m_Size = 0;
+    size_t m_OffsetBytes = sizeof(uint16_t);
+    std::vector<uint8_t> m_Ends;
+
+    template<class Offset>
+    size_t load(const size_t index) const noexcept
+    {
+        Offset offset;
+        std::memcpy(&offset, m_Ends.data() + index * sizeof(Offset), sizeof(Offset));
+        return static_cast<size_t>(offset);
+    }
+
+    template<class Offset>
+    void store(const size_t index, const size_t end) noexcept
+    {
+        const Offset offset = static_cast<Offset>(end);
+        std::memcpy(m_Ends.data() + index * sizeof(Offset), &offset, sizeof(Offset));
+    }
+
+    size_t tokenEnd(const size_t index) const noexcept
+    {
+        switch (m_OffsetBytes)
+        {
+            case sizeof(uint16_t):
+                return load<uint16_t>(index);
+            case sizeof(uint32_t):
+                return load<uint32_t>(index);
+            default:
+                return load<uint64_t>(index);
+        }
+    }
+
+    template<class Offset, class ForEachSeparator>
+    void fill(ForEachSeparator& forEachSeparator)
+    {
+        size_t index = 0;
+        auto visitor = [this, &index](const size_t position) {
+            store<Offset>(index, position);
+            return ++index + 1 < m_Size;
+        };
+        if (m_Size > 1)
+        {
+            forEachSeparator(visitor);
+        }
+        store<Offset>(m_Size - 1, m_SourceSize);
+    }
+
+    /**
+    * Sizes the offsets exactly for separatorCount separators (already limited to maxSplits), then stores their positions
+    */
+    template<class ForEachSeparator>
+    void build(const std::string_view source, const size_t separatorSize, const size_t separatorCount, ForEachSeparator&& forEachSeparator)
+    {
+        m_Source = source.data();
+        m_SourceSize = source.size();
+        m_SeparatorSize = separatorSize;
+        m_Size = separatorCount + 1;
+        m_OffsetBytes = (source.size() <= UINT16_MAX) ? sizeof(uint16_t) : (source.size() <= UINT32_MAX) ? sizeof(uint32_t) : sizeof(uint64_t);
+        m_Ends.resize(m_Size * m_OffsetBytes);
+        switch (m_OffsetBytes)
+        {
+            case sizeof(uint16_t):
+                fill<uint16_t>(forEachSeparator);
+                break;
+            case sizeof(uint32_t):
+                fill<uint32_t>(forEachSeparator);
+                break;
+            default:
+                fill<uint64_t>(forEachSeparator);
+                break;
+        }
+    }
+
+  public:
+    class iterator
+    {
+      private:
+        const TokenIndex* m_Index = nullptr;
+        size_t m_Position = 0;
+
+      public:
+        using iterator_category = std::input_iterator_tag; // operator* returns by value, which a LegacyForwardIterator may not
+        using iterator_concept = std::forward_iterator_tag; // C++20 allows a forward iterator to do so
+        using value_type = std::string_view;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = std::string_view;
+
+        iterator() noexcept = default;
+
+        iterator(const TokenIndex* const index, const size_t position) noexcept
+            : m_Index(index), m_Position(position)
+        {
+        }
+
+        std::string_view operator*() const noexcept
+        {
+            return (*m_Index)[m_Position];
+        }
+
+        iterator& operator++() noexcept
+        {
+            ++m_Position;
+            return *this;
+        }
+
+        iterator operator++(int) noexcept
+        {
+            iterator previous = *this;
+            ++m_Position;
+            return previous;
+        }
+
+        friend bool operator==(const iterator& lhs, const iterator& rhs) noexcept
+        {
+            return lhs.m_Position == rhs.m_Position;
+        }
+
+        friend bool operator!=(const iterator& lhs, const iterator& rhs) noexcept
+        {
+            return lhs.m_Position != rhs.m_Position;
+        }
+    };
+
+    using const_iterator = iterator;
+
+    TokenIndex() noexcept = default;
+
+    TokenIndex(const std::string_view source, const char separator, const size_t maxSplits = INDEX_NOT_FOUND)
+    {
+        assign(source, separator, maxSplits);
+    }
+
+    TokenIndex(const std::string_view source, const std::string_view separator, const size_t maxSplits = INDEX_NOT_FOUND)
+    {
+        assign(source, separator, maxSplits);
+    }
+
+    /**
+    * Splits source like split(source, separator, maxSplits), the storage of a previous split is reused
+    */
+    void assign(const std::string_view source, const char separator, const size_t maxSplits = INDEX_NOT_FOUND)
+    {
+        build(source, 1, std::min(Detail::count(source.data(), source.size(), separator), maxSplits),
+            [source, separator](auto& visitor) { Detail::forEachChar(source.data(), source.size(), separator, visitor); });
+    }
+
+    void assign(const std::string_view source, const std::string_view separator, const size_t maxSplits = INDEX_NOT_FOUND)
+    {
+        if (separator.size() == 1)
+        {
+            assign(source, separator[0], maxSplits);
+        }
+        else if (separator.empty())
+        { // splits in front of every char like splitNoSeparator, "abc" => ["", "a", "b", "c"]
+            build(source, 0, std::min(source.size(), maxSplits), [&source](auto& visitor) {
+                for (size_t position = 0; position < source.size() && visitor(position); ++position)
+                {
+                }
+            });
+        }
+        else
+        {
+            Detail::LazyTwoWay<false> twoWay;
+            build(source, separator.size(), std::min(Detail::count(source.data(), source.size(), separator.data(), separator.size()), maxSplits),
+                [source, separator, &twoWay](auto& visitor) {
+                    for (size_t position = Detail::find(source.data(), source.size(), 0, separator.data(), separator.size(), twoWay);
+                         position != INDEX_NOT_FOUND && visitor(position);
+                         position = Detail::find(source.data(), source.size(), position + separator.size(), separator.data(), separator.size(), twoWay))
+                    {
+                    }
+                });
+        }
+    }
+
+    std::string_view operator[](const size_t index) const noexcept
+    {
+        const size_t begin = (index == 0) ? 0 : tokenEnd(index - 1) + m_SeparatorSize;
+        return std::string_view(m_Source + begin, tokenEnd(index) - begin);
+    }
+
+    size_t size() const noexcept
+    {
+        return m_Size;
+    }
+
+    bool empty() const noexcept
+    {
+        return m_Size == 0;
+    }
+
+    /**
+    * Bytes per stored offset: 2, 4 or 8
+    */
+    size_t offsetBytes() const noexcept
+    {
+        return m_OffsetBytes;
+    }
+
+    std::string_view source() const noexcept
+    {
+        return std::string_view(m_Source, m_SourceSize);
+    }
+
+    iterator begin() const noexcept
+    {
+        return iterator(this, 0);
+    }
+
+    iterator end() const noexcept
+    {
+        return iterator(this, m_Size);
+    }
+
+    void clear() noexcept
+    {
+        m_Source = nullptr;
+        m_SourceSize = 0;
+        m_Size = 0;
+        m_Ends.clear();
+    }
+};
+
+
+//#######################################################################################
+//
+//                                      OwnedSplit
+//
+//#######################################################################################
+
+
+class OwnedSplit;
+
+namespace Detail {
+template<bool skipEmpty, class Separator>
+inline OwnedSplit splitOwned(std::string_view source, const Separator& separator, size_t separatorCount, size_t maxSplits);
+} // namespace Detail
+
+class OwnedSplit
+{ // one block holds the views followed by the chars of all parts back to back, moving keeps the block so the views stay valid
+  private:
+    std::unique_ptr<char[]> m_Block;
+    const std::string_view* m_Parts = nullptr; // the views placement new created at the start of m_Block
+    size_t m_Size = 0;
+
+    /**
+    * Copies parts in one pass into one allocation, maxPartCount bounds the number of parts and charCount is their exact total size
+    */
+    template<class Range>
+    OwnedSplit(const Range& parts, const size_t maxPartCount, const size_t charCount)
+    {
+        if (maxPartCount == 0)
+        {
+            return;
+        }
+        // new char[] is aligned for any fundamental type of its size, so the views can start the block
+        m_Block.reset(new char[maxPartCount * sizeof(std::string_view) + charCount]);
+        char* const viewBytes = m_Block.get();
+        char* chars = m_Block.get() + maxPartCount * sizeof(std::string_view);
+        for (const std::string_view part : parts)
+        {
+            if (!part.empty())
+            {
+                std::memcpy(chars, part.data(), part.size());
+            }
+            const std::string_view* const view = new (viewBytes + m_Size * sizeof(std::string_view)) std::string_view(chars, part.size());
+            if (m_Size++ == 0)
+            {
+                m_Parts = view;
+            }
+            chars += part.size();
+        }
+    }
+
+    template<class Range>
+    static auto partCount(const Range& parts, int) -> decltype(static_cast<size_t>(parts.size()))
+    {
+        return static_cast<size_t>(parts.size());
+    }
+
+    template<class Range>
+    static size_t partCount(const Range& /*parts*/, long)
+    {
+        return INDEX_NOT_FOUND;
+    }
+
+    template<bool skipEmpty, class Separator>
+    friend OwnedSplit Detail::splitOwned(std::string_view source, const Separator& separator, size_t separatorCount, size_t maxSplits);
+
+  public:
+    using iterator = const std::string_view*;
+    using const_iterator = const std::string_view*;
+
+    OwnedSplit() noexcept = default;
+
+    /**
+    * Copies every string_view of parts (a TokenIndex, vector, SplitView, ...)
+    * A range with size() is copied into one allocation, a lazy range is collected into a vector first (its size is unknown),
+    * the splitOwned functions copy a split into one allocation because they size the block with a count
+    */
+    template<class Range>
+    explicit OwnedSplit(const Range& parts)
+    {
+        const size_t count = partCount(parts, 0);
+        if (count != INDEX_NOT_FOUND)
+        {
+            size_t charCount = 0;
+            for (const std::string_view part : parts)
+            {
+                charCount += part.size();
+            }
+            *this = OwnedSplit(parts, count, charCount);
+            return;
+        }
+        std::vector<std::string_view> views;
+        size_t charCount = 0;
+        for (const std::string_view part : parts)
+        {
+            views.push_back(part);
+            charCount += part.size();
+        }
+        *this = OwnedSplit(views, views.size(), charCount);
+    }
+
+    OwnedSplit(OwnedSplit&& other) noexcept
+        : m_Block(std::move(other.m_Block))
+        , m_Parts(std::exchange(other.m_Parts, nullptr))
+        , m_Size(std::exchange(other.m_Size, 0))
+    {
+    }
+
+    OwnedSplit& operator=(OwnedSplit&& other) noexcept
+    {
+        m_Block = std::move(other.m_Block);
+        m_Parts = std::exchange(other.m_Parts, nullptr);
+        m_Size = std::exchange(other.m_Size, 0);
+        return *this;
+    }
+
+    OwnedSplit(const OwnedSplit&) = delete;
+    OwnedSplit& operator=(const OwnedSplit&) = delete;
+
+    std::string_view operator[](const size_t index) const noexcept
+    {
+        return m_Parts[index];
+    }
+
+    size_t size() const noexcept
+    {
+        return m_Size;
+    }
+
+    bool empty() const noexcept
+    {
+        return m_Size == 0;
+    }
+
+    iterator begin() const noexcept
+    {
+        return m_Parts;
+    }
+
+    iterator end() const noexcept
+    {
+        return m_Parts + m_Size;
+    }
+};
+
+
+namespace Detail {
+/**
+* Number of separators split cuts at when maxSplits is unlimited, an empty separator cuts in front of every char
+*/
+inline size_t countSeparators(const std::string_view source, const std::string_view separator) noexcept
+{
+    return separator.empty() ? source.size() : count(source.data(), source.size(), separator.data(), separator.size());
+}
+
+/**
+* Copies a split into one allocation sized by separatorCount (the separators split would cut at without maxSplits)
+* skipEmpty only drops empty parts, so min(separatorCount, maxSplits) + 1 bounds the parts and the chars are the source minus the cut separators
+*/
+template<bool skipEmpty, class Separator>
+inline OwnedSplit splitOwned(const std::string_view source, const Separator& separator, const size_t separatorCount, const size_t maxSplits)
+{
+    const size_t splits = std::min(separatorCount, maxSplits);
+    return OwnedSplit(SplitView<Separator, skipEmpty>(source, separator, maxSplits), splits + 1, source.size() - splits * separator.size());
+}
+} // namespace Detail
+
+
+//#######################################################################################
+//
+//                                      KeyValue
+//
+//#######################################################################################
+
+
+struct KeyValue
+{
+    std::string_view key;
+    std::string_view value;
+
+    [[nodiscard]] friend constexpr bool operator==(const KeyValue& lhs, const KeyValue& rhs) noexcept
+    {
+        return lhs.key == rhs.key && lhs.value == rhs.value;
+    }
+
+    [[nodiscard]] friend constexpr bool operator!=(const KeyValue& lhs, const KeyValue& rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+};
+
+namespace Detail {
+struct KeyValueParser
+{
+    char pairSeparator = '\0';
+    char keyValueSeparator = '\0';
+    CharSet separators;
+    CharSet stripChars;
+    bool strip = false;
+
+    constexpr KeyValueParser() noexcept = default;
+
+    constexpr KeyValueParser(const char pairSeparator_, const char keyValueSeparator_, const bool strip_, const CharSet& stripChars_) noexcept
+        : pairSeparator(pairSeparator_)
+        , keyValueSeparator(keyValueSeparator_)
+        , separators(CharSet().add(pairSeparator_).add(keyValueSeparator_))
+        , stripChars(stripChars_)
+        , strip(strip_)
+    {
+    }
+
+    constexpr std::string_view stripped(std::string_view str) const noexcept
+    { // keys and values are short, a scalar loop beats the classify kernels here
+        while (!str.empty() && stripChars.contains(str.front()))
+        {
+            str.remove_prefix(1);
+        }
+        while (!str.empty() && stripChars.contains(str.back()))
+        {
+            str.remove_suffix(1);
+        }
+        return str;
+    }
+
+    /**
+    * Calls emit(pair, position after the pair) for every pair at or after position with a non empty key, until it returns false
+    * A single block scan for either separator visits the source: the first keyValueSeparator of a pair ends its key,
+    * the next pairSeparator ends the pair, so the value may contain keyValueSeparator. A pair without keyValueSeparator has an empty value.
+    */
+    template<class Emit>
+    constexpr void forEachPair(const std::string_view source, const size_t position, Emit& emit) const noexcept
+    {
+        size_t pairStart = position;
+        size_t keyEnd = INDEX_NOT_FOUND;
+        const auto endPair = [this, &source, &pairStart, &keyEnd, &emit](const size_t pairEnd) {
+            std::string_view key = source.substr(pairStart, ((keyEnd == INDEX_NOT_FOUND) ? pairEnd : keyEnd) - pairStart);
+            std::string_view value = (keyEnd == INDEX_NOT_FOUND) ? std::string_view() : source.substr(keyEnd + 1, pairEnd - keyEnd - 1);
+            pairStart = pairEnd + 1;
+            keyEnd = INDEX_NOT_FOUND;
+            if (strip)
+            {
+                key = stripped(key);
+                value = stripped(value);
+            }
+            return key.empty() || emit(KeyValue{ key, value }, pairStart);
+        };
+        bool more = true;
+        auto visitor = [this, &source, position, &keyEnd, &endPair, &more](const size_t index) {
+            const size_t separator = position + index;
+            if (source[separator] == keyValueSeparator && keyEnd == INDEX_NOT_FOUND)
+            {
+                keyEnd = separator;
+                return true;
+            }
+            if (source[separator] != pairSeparator)
+            { // a keyValueSeparator in the value
+                return true;
+            }
+            more = endPair(separator);
+            return more;
+        };
+#if STRINGUTILS_HAS_SIMD_CLASSIFY
+        if (!isConstantEvaluated())
+        {
+            forEachCharClass<false>(source.data() + position, source.size() - position, separators, visitor);
+        }
+        else
+#endif
+        {
+            for (size_t index = 0; index < source.size() - position && (!separators.contains(source[position + index]) || visitor(index)); ++index)
+            {
+            }
+        }
+        if (more)
+        {
+            endPair(source.size());
+        }
+    }
+
+    /**
+    * Parses the first pair with a non empty key at or after position into pair and returns the position after it, INDEX_NOT_FOUND if there is none
+    */
+    constexpr size_t next(const std::string_view source, const size_t position, KeyValue& pair) const noexcept
+    {
+        size_t after = INDEX_NOT_FOUND;
+        if (position <= source.size())
+        {
+            auto emit = [&pair, &after](const KeyValue& found, const size_t foundAfter) {
+                pair = found;
+                after = foundAfter;
+                return false;
+            };
+            forEachPair(source, position, emit);
+        }
+        return after;
+    }
+};
+} // namespace Detail
+
+
+class KeyValueView
+{ // the iterators carry a copy of the parser, so they stay valid when the view is gone
+  private:
+    std::string_view m_Source;
+    Detail::KeyValueParser m_Parser;
+
+  public:
+    class iterator
+    {
+      public:
+        using iterator_category = std::input_iterator_tag; // operator* returns by value, which a LegacyForwardIterator may not
+        using iterator_concept = std::forward_iterator_tag; // C++20 allows a forward iterator to do so
+        using value_type = KeyValue;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = KeyValue;
+
+      private:
+        std::string_view m_Source;
+        Detail::KeyValueParser m_Parser;
+        KeyValue m_Pair;
+        size_t m_Next = INDEX_NOT_FOUND; // the position after m_Pair, INDEX_NOT_FOUND at the end
+
+        friend class KeyValueView;
+
+        constexpr iterator(const std::string_view source, const Detail::KeyValueParser& parser) noexcept
+            : m_Source(source)
+            , m_Parser(parser)
+            , m_Next(parser.next(source, 0, m_Pair))
+        {
+        }
+
+      public:
+        constexpr iterator() noexcept = default;
+
+        [[nodiscard]] constexpr reference operator*() const noexcept
+        {
+            return m_Pair;
+        }
+
+        constexpr iterator& operator++() noexcept
+        {
+            m_Next = m_Parser.next(m_Source, m_Next, m_Pair);
+            return *this;
+        }
+
+        constexpr iterator operator++(int) noexcept
+        {
+            iterator copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        [[nodiscard]] friend constexpr bool operator==(const iterator& lhs, const iterator& rhs) noexcept
+        { // all iterators at the end are equal, the end of one view is also the end of any other
+            return lhs.m_Next == rhs.m_Next && (lhs.m_Next == INDEX_NOT_FOUND || lhs.m_Source.data() == rhs.m_Source.data());
+        }
+
+        [[nodiscard]] friend constexpr bool operator!=(const iterator& lhs, const iterator& rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+    };
+
+    using const_iterator = iterator;
+
+    constexpr KeyValueView() noexcept = default;
+
+    constexpr KeyValueView(const std::string_view source, const Detail::KeyValueParser& parser) noexcept
+        : m_Source(source)
+        , m_Parser(parser)
+    {
+    }
+
+    [[nodiscard]] constexpr iterator begin() const noexcept
+    {
+        return iterator(m_Source, m_Parser);
+    }
+
+    [[nodiscard]] constexpr iterator end() const noexcept
+    {
+        return iterator();
+    }
+};
+} // namespace STRINGUTILS_NAMESPACE
+
+
+#if defined(__cpp_lib_ranges)
+namespace std::ranges {
+template<>
+inline constexpr bool enable_view<STRINGUTILS_NAMESPACE::KeyValueView> = true;
+
+template<>
+inline constexpr bool enable_borrowed_range<STRINGUTILS_NAMESPACE::KeyValueView> = true;
+} // namespace std::ranges
+#endif
+
+
+namespace STRINGUTILS_NAMESPACE {
+
+
+//#######################################################################################
+//
+//                                      StreamSplitter
+//
+//#######################################################################################
+
+
+class StreamSplitter
+{ // the complete parts are views into the chunk, only a part crossing chunks is assembled in m_Buffer
+  private:
+    enum class Kind
+    {
+        Char,
+        String,
+        CharSet
+    };
+
+    Kind m_Kind;
+    char m_SeparatorChar = '\0';
+    std::string m_Separator;
+    Detail::LazyTwoWay<false> m_TwoWay; // factorization of a long m_Separator, computed once for all chunks
+    CharSet m_Separators;
+    bool m_SkipEmpty = false;
+    std::string m_Buffer; // the unfinished last part, it never holds a complete separator
+
+    template<class PartCallback>
+    void emit(const std::string_view part, PartCallback& onPart) const
+    {
+        if (!m_SkipEmpty || !part.empty())
+        {
+            onPart(part);
+        }
+    }
+
+    template<class PartCallback>
+    void emitBuffered(const std::string_view end, PartCallback& onPart)
+    { // the part began in an earlier chunk and ends with end
+        m_Buffer.append(end.data(), end.size());
+        emit(m_Buffer, onPart);
+        m_Buffer.clear();
+    }
+
+    template<class PartCallback>
+    void feedChars(const std::string_view chunk, PartCallback& onPart)
+    {
+        size_t start = 0;
+        auto visitor = [&](const size_t index) {
+            const std::string_view part(chunk.data() + start, index - start);
+            if (start == 0 && !m_Buffer.empty())
+            {
+                emitBuffered(part, onPart);
+            }
+            else
+            {
+                emit(part, onPart);
+            }
+            start = index + 1;
+            return true;
+        };
+        if (m_Kind == Kind::Char)
+        {
+            Detail::forEachChar(chunk.data(), chunk.size(), m_SeparatorChar, visitor);
+        }
+        else
+        {
+            Detail::forEachCharClass<false>(chunk.data(), chunk.size(), m_Separators, visitor);
+        }
+        m_Buffer.append(chunk.data() + start, chunk.size() - start);
+    }
+
+    template<class PartCallback>
+    void feedString(std::string_view chunk, PartCallback& onPart)
+    {
+        const size_t separatorSize = m_Separator.size();
+        if (separatorSize == 0)
+        { // splits in front of every char like split(source, "")
+            if (!chunk.empty())
+            {
+                emit(m_Buffer, onPart);
+                for (size_t i = 0; i + 1 < chunk.size(); ++i)
+                {
+                    emit(std::string_view(chunk.data() + i, 1), onPart);
+                }
+                m_Buffer.assign(1, chunk.back());
+            }
+            return;
+        }
+
+        if (!m_Buffer.empty())
+        { // a separator may begin in the last separatorSize - 1 chars of the buffer
+            const size_t bufferSize = m_Buffer.size();
+            const size_t overlap = std::min(separatorSize - 1, bufferSize);
+            m_Buffer.append(chunk.data(), std::min(separatorSize - 1, chunk.size()));
+            const size_t end = Detail::find(m_Buffer.data(), m_Buffer.size(), bufferSize - overlap, m_Separator.data(), separatorSize, m_TwoWay);
+            if (end != INDEX_NOT_FOUND)
+            {
+                m_Buffer.resize(end);
+                emit(m_Buffer, onPart);
+                m_Buffer.clear();
+                chunk.remove_prefix(end + separatorSize - bufferSize);
+            }
+            else
+            {
+                m_Buffer.resize(bufferSize);
+                const size_t chunkEnd = Detail::find(chunk.data(), chunk.size(), 0, m_Separator.data(), separatorSize, m_TwoWay);
+                if (chunkEnd == INDEX_NOT_FOUND)
+                {
+                    m_Buffer.append(chunk.data(), chunk.size());
+                    return;
+                }
+                emitBuffered(std::string_view(chunk.data(), chunkEnd), onPart);
+                chunk.remove_prefix(chunkEnd + separatorSize);
+            }
+        }
+
+        for (;;)
+        {
+            const size_t end = Detail::find(chunk.data(), chunk.size(), 0, m_Separator.data(), separatorSize, m_TwoWay);
+            if (end == INDEX_NOT_FOUND)
+            {
+                break;
+            }
+            emit(std::string_view(chunk.data(), end), onPart);
+            chunk.remove_prefix(end + separatorSize);
+        }
+        m_Buffer.append(chunk.data(), chunk.size());
     }
-    return list;
-}
 
-template<class StringOrStringView, class StringView, typename std::enable_if<std::is_same<StringOrStringView, std::string>::value, bool>::type = true>
-inline std::vector<StringOrStringView> splitNoSeparatorSkipEmpty(StringView source, size_t maxSplits)
-{
-    const size_t sourceLength = source.length();
-    maxSplits = std::min(sourceLength, maxSplits);
-    if (maxSplits == 0)
+  public:
+    explicit StreamSplitter(const char separator, const bool skipEmpty = false)
+        : m_Kind(Kind::Char)
+        , m_SeparatorChar(separator)
+        , m_SkipEmpty(skipEmpty)
     {
-        return constructSingleElementVector<std::string>(source);
     }
 
-    std::vector<StringOrStringView> list(maxSplits, std::string(1, '?'));
-    for (size_t j = 0; j < maxSplits - 1; ++j)
+    explicit StreamSplitter(const std::string_view separator, const bool skipEmpty = false)
+        : m_Kind(Kind::String)
+        , m_Separator(separator)
+        , m_SkipEmpty(skipEmpty)
     {
-        list[j][0] = source[j];
     }
-    list[maxSplits - 1].assign(source.data() + maxSplits - 1, sourceLength + 1 - maxSplits);
-    return list;
-}
 
-
-template<class StringOrStringView, class StringView, size_t maxSplits, typename std::enable_if<std::is_same<StringOrStringView, StringView>::value, bool>::type = true>
-constexpr inline STRINGUTILS_NAMESPACE::SplitResult<StringOrStringView, maxSplits> splitNoSeparatorSkipEmpty(StringView source)
-{
-    STRINGUTILS_NAMESPACE::SplitResult<StringOrStringView, maxSplits> result;
-    const size_t sourceLength = source.length();
-    const size_t totalSplits = std::min(maxSplits, sourceLength);
-    result.size = totalSplits;
-    if (totalSplits == 0)
+    explicit StreamSplitter(const CharSet& separators, const bool skipEmpty = false)
+        : m_Kind(Kind::CharSet)
+        , m_Separators(separators)
+        , m_SkipEmpty(skipEmpty)
     {
-        result.parts[0] = source;
-        return result;
     }
 
-    for (size_t j = 0; j < totalSplits - 1; ++j)
+    template<class PartCallback>
+    void feed(const std::string_view chunk, PartCallback&& onPart)
     {
-        result.parts[j] = StringView(source.data() + j, 1);
+        if (m_Kind == Kind::String)
+        {
+            feedString(chunk, onPart);
+        }
+        else
+        {
+            feedChars(chunk, onPart);
+        }
     }
-    result.parts[totalSplits - 1] = StringView(source.data() + totalSplits - 1, sourceLength + 1 - totalSplits);
-    return result;
-}
 
-template<class StringOrStringView, class StringView, size_t maxSplits, typename std::enable_if<std::is_same<StringOrStringView, std::string>::value, bool>::type = true>
-inline STRINGUTILS_NAMESPACE::SplitResult<StringOrStringView, maxSplits> splitNoSeparatorSkipEmpty(StringView source)
-{
-    STRINGUTILS_NAMESPACE::SplitResult<StringOrStringView, maxSplits> result;
-    const size_t sourceLength = source.length();
-    const size_t totalSplits = std::min(maxSplits, sourceLength);
-    result.size = totalSplits + 1;
-    if (totalSplits == 0)
+    template<class PartCallback>
+    void flush(PartCallback&& onPart)
     {
-        result.parts[0].assign(source.data(), source.size());
-        return result;
+        emit(m_Buffer, onPart);
+        m_Buffer.clear();
     }
-    for (size_t j = 0; j < totalSplits - 1; ++j)
+
+    [[nodiscard]] std::string_view pending() const noexcept
     {
-        result.parts[j].assign(source.data() + j, 1);
+        return m_Buffer;
     }
-    result.parts[totalSplits].assign(source.data() + totalSplits - 1, sourceLength + 1 - totalSplits);
-    return result;
-}
 
-
-template<class StringOrStringView, class StringView>
-[[nodiscard]] inline std::vector<StringOrStringView> split(StringView source, const StringView separator)
-{
-    const size_t separatorSize = separator.size();
-    if (separatorSize == 0)
+    void reset() noexcept
     {
-        return Detail::splitNoSeparator<StringOrStringView>(source);
+        m_Buffer.clear();
     }
-    std::vector<StringOrStringView> list;
-    for (;;)
+};
+
+
+//#######################################################################################
+//
+//                                      MappedFile
+//
+//#######################################################################################
+
+
+#if STRINGUTILS_HAS_MMAP
+class MappedFile
+{ // read only private mapping of a whole file, unmapped in the destructor
+  private:
+    const char* m_Data = nullptr; // stays nullptr for empty files, they can not be mapped
+    size_t m_Size = 0;
+    bool m_IsOpen = false;
+
+    void unmap() noexcept
     {
-        const size_t end = source.find(separator, 0);
-        if (end == INDEX_NOT_FOUND)
+        if (m_Data != nullptr)
         {
-            break;
+            ::munmap(const_cast<char*>(m_Data), m_Size);
         }
-
-        list.emplace_back(source.data(), end);
-        source.remove_prefix(end + separatorSize);
+        m_Data = nullptr;
+        m_Size = 0;
+        m_IsOpen = false;
     }
-    list.emplace_back(source.data(), source.size());
-    return list;
-}
 
+  public:
+    MappedFile() noexcept = default;
 
-template<class StringOrStringView, class StringView>
-[[nodiscard]] inline std::vector<StringOrStringView> split(StringView source, const char separator)
-{
-    std::vector<StringOrStringView> list;
-    for (;;)
+    explicit MappedFile(const char* const path) noexcept
     {
-        const size_t end = source.find(separator, 0);
-        if (end == INDEX_NOT_FOUND)
+        const int file = ::open(path, O_RDONLY | O_CLOEXEC);
+        if (file < 0)
         {
-            break;
+            return;
+        }
+        struct stat status;
+        if (::fstat(file, &status) == 0 && S_ISREG(status.st_mode))
+        {
+            const size_t size = static_cast<size_t>(status.st_size);
+            if (size == 0)
+            {
+                m_IsOpen = true;
+            }
+            else
+            {
+                void* const data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+                if (data != MAP_FAILED)
+                {
+                    ::madvise(data, size, MADV_SEQUENTIAL); // read ahead aggressively and drop the pages behind the reader
+                    m_Data = static_cast<const char*>(data);
+                    m_Size = size;
+                    m_IsOpen = true;
+                }
+            }
         }
+        ::close(file); // the mapping stays valid without the descriptor
+    }
 
-        list.emplace_back(source.data(), end);
-        source.remove_prefix(end + 1);
+    explicit MappedFile(const std::string& path) noexcept
+        : MappedFile(path.c_str())
+    {
     }
-    list.emplace_back(source.data(), source.size());
-    return list;
-}
 
+    MappedFile(const MappedFile&) = delete;
 
-template<class StringOrStringView, class StringView>
-[[nodiscard]] inline std::vector<StringOrStringView> split(StringView source, const StringView separator, const size_t maxSplits)
-{
-    const size_t separatorSize = separator.size();
-    if (separatorSize == 0)
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other) noexcept
+        : m_Data(other.m_Data)
+        , m_Size(other.m_Size)
+        , m_IsOpen(other.m_IsOpen)
     {
-        return Detail::splitNoSeparator<StringOrStringView>(source, maxSplits);
+        other.m_Data = nullptr;
+        other.m_Size = 0;
+        other.m_IsOpen = false;
     }
-    std::vector<StringOrStringView> list;
 
-    for (size_t splits = 0; splits < maxSplits; ++splits)
+    MappedFile& operator=(MappedFile&& other) noexcept
     {
-        const size_t end = source.find(separator, 0);
-        if (end == INDEX_NOT_FOUND)
+        if (this != &other)
         {
-            break;
+            unmap();
+            std::swap(m_Data, other.m_Data);
+            std::swap(m_Size, other.m_Size);
+            std::swap(m_IsOpen, other.m_IsOpen);
         }
-
-        list.emplace_back(source.data(), end);
-        source.remove_prefix(end + separatorSize);
+        return *this;
     }
-    list.emplace_back(source.data(), source.size());
-    return list;
-}
 
-template<class StringOrStringView, class StringView>
-[[nodiscard]] inline std::vector<StringOrStringView> split(StringView source, const char separator, const size_t maxSplits)
-{
-    std::vector<StringOrStringView> list;
-    for (size_t splits = 0; splits < maxSplits; ++splits)
+    ~MappedFile()
     {
-        const size_t end = source.find(separator, 0);
-        if (end == INDEX_NOT_FOUND)
-        {
-            break;
-        }
-
-        list.emplace_back(source.data(), end);
-        source.remove_prefix(end + 1);
+        unmap();
     }
-    list.emplace_back(source.data(), source.size());
-    return list;
-}
-
 
-template<class StringOrStringView, class StringView, size_t maxSplits>
-[[nodiscard]] inline STRINGUTILS_NAMESPACE::SplitResult<StringOrStringView, maxSplits> split(StringView source, const StringView separator)
-{
-    const size_t separatorSize = separator.size();
-    if (separatorSize == 0)
+    [[nodiscard]] bool isOpen() const noexcept
     {
-        return Detail::splitNoSeparator<StringOrStringView, maxSplits>(source);
+        return m_IsOpen;
     }
-    STRINGUTILS_NAMESPACE::SplitResult<StringOrStringView, maxSplits> result;
-    size_t splits = 0;
 
-    for (; splits < maxSplits; ++splits)
+    [[nodiscard]] const char* data() const noexcept
     {
-        const size_t end = source.find(separator, 0);
-        if (end == INDEX_NOT_FOUND)
-        {
-            break;
-        }
-
-        assign(result.parts[splits], source.data(), end);
-        source.remove_prefix(end + separatorSize);
+        return m_Data;
     }
-    assign(result.parts[splits], source.data(), source.size());
-    result.size = splits + 1;
-    return result;
-}
 
-
-template<class StringOrStringView, class StringView, size_t maxSplits>
-[[nodiscard]] inline STRINGUTILS_NAMESPACE::SplitResult<StringOrStringView, maxSplits> split(StringView source, const char separator)
-{
-    STRINGUTILS_NAMESPACE::SplitResult<StringOrStringView, maxSplits> result;
-    size_t splits = 0;
-    for (; splits < maxSplits; ++splits)
+    [[nodiscard]] size_t size() const noexcept
     {
-        const size_t end = source.find(separator, 0);
-        if (end == INDEX_NOT_FOUND)
-        {
-            break;
-        }
-        assign(result.parts[splits], source.data(), end);
-        source.remove_prefix(end + 1);
+        return m_Size;
     }
-    assign(result.parts[splits], source.data(), source.size());
-    result.size = splits + 1;
-    return result;
-}
 
-
-template<class StringOrStringView, class StringView>
-[[nodiscard]] inline std::vector<StringOrStringView> splitAnyOf(StringView source, const StringView separators)
-{
-    if (separators.size() == 0)
+    [[nodiscard]] std::string_view view() const noexcept
     {
-        return constructSingleElementVector<StringOrStringView>(source);
+        return std::string_view(m_Data, m_Size);
     }
-    std::vector<StringOrStringView> list;
-    for (;;)
+
+    [[nodiscard]] SplitView<Detail::CharSeparator, false> lines() const noexcept
     {
-        const size_t end = source.find_first_of(separators, 0);
-        if (end == INDEX_NOT_FOUND)
-        {
-            break;
+        std::string_view text = view();
+        if (text.empty())
+        { // no content, no lines
+            return SplitView<Detail::CharSeparator, false>::none();
         }
-
-        list.emplace_back(source.data(), end);
-        source.remove_prefix(end + 1);
+        if (text.back() == '\n')
+        { // the final newline ends the last line instead of starting an empty one, "\n" is one empty line
+            text.remove_suffix(1);
+        }
+        return SplitView<Detail::CharSeparator, false>(text, Detail::CharSeparator{ '\n' }, INDEX_NOT_FOUND);
     }
-    list.emplace_back(source.data(), source.size());
-    return list;
-}
 
-template<class StringOrStringView, class StringView>
-[[nodiscard]] inline std::vector<StringOrStringView> splitAnyOf(std::string_view source, const std::string_view separators, const size_t maxSplits)
-{
-    if (separators.size() == 0)
+    [[nodiscard]] SplitView<Detail::CharSetSeparator<false>, true> tokens(const CharSet& separators) const noexcept
     {
-        return constructSingleElementVector<StringOrStringView>(source);
+        return SplitView<Detail::CharSetSeparator<false>, true>(view(), Detail::CharSetSeparator<false>{ separators }, INDEX_NOT_FOUND);
     }
-    std::vector<StringOrStringView> list;
-    for (size_t splits = 0; splits < maxSplits; ++splits)
-    {
-        const size_t end = source.find_first_of(separators, 0);
-        if (end == INDEX_NOT_FOUND)
-        {
-            break;
-        }
+};
+#endif
 
-        list.emplace_back(source.data(), end);
-        source.remove_prefix(end + 1);
-    }
-    list.emplace_back(source.data(), source.size());
-    return list;
-}
 
+//#######################################################################################
+//
+//                                      Searcher
+//
+//#######################################################################################
 
-template<class StringOrStringView, class StringView, size_t maxSplits>
-[[nodiscard]] inline STRINGUTILS_NAMESPACE::SplitResult<StringOrStringView, maxSplits> splitAnyOf(std::string_view source, const std::string_view separators)
+
+namespace Detail {
+/**
+* Rough frequency rank of a char in text and log data, a higher rank means more common
+* Chars that are not listed (control chars, non ascii, rare punctuation) are considered the rarest
+* Used by BasicSearcher to filter on the rarest chars of the needle
+*/
+constexpr inline size_t charFrequencyRank(const char c) noexcept
 {
-    STRINGUTILS_NAMESPACE::SplitResult<StringOrStringView, maxSplits> result;
-    if (separators.size() == 0)
-    {
-        assign(result.parts[0], source.data(), source.size());
-        result.size = 1;
-        return result;
-    }
-    size_t splits = 0;
-    for (; splits < maxSplits; ++splits)
+    constexpr const char* charsByFrequency = "QJZXKVYWGUBFPHMLCDNIROSTEA()\"';=_,9876543210\t-qjzxkvbpgwyfmculdrhsnioate\n:./ ";
+    for (size_t j = 0; charsByFrequency[j] != '\0'; ++j)
     {
-        const size_t end = source.find_first_of(separators, 0);
-        if (end == INDEX_NOT_FOUND)
+        if (charsByFrequency[j] == c)
         {
-            break;
+            return j + 1;
         }
-        assign(result.parts[splits], source.data(), end);
-        source.remove_prefix(end + 1);
     }
-    assign(result.parts[splits], source.data(), source.size());
-    return result;
+    return 0;
 }
+} // namespace Detail
 
 
-template<class StringOrStringView, class StringView>
-[[nodiscard]] inline std::vector<StringOrStringView> splitAnyBut(StringView source, const StringView separators)
-{
-    std::vector<StringOrStringView> list;
-    for (;;)
+template<bool ignoreCase>
+class BasicSearcher
+{ // preprocesses the needle once so repeated searches have no setup cost
+  private:
+    std::string_view m_Needle;
+    Detail::TwoWayFactorization m_Factorization; // only used if the needle is longer than Detail::twoWayThreshold
+    size_t m_RareOffset1 = 0;                    // offsets of the rarest chars of the needle, used by the simd filter
+    size_t m_RareOffset2 = 0;
+    uint8_t m_Skip[256] = {}; // Horspool shift for each (folded) char, clamped to 255, only built if horspoolFind can run
+
+  public:
+    constexpr explicit BasicSearcher(const std::string_view needle) noexcept
+        : m_Needle(needle)
     {
-        const size_t end = source.find_first_not_of(separators, 0);
-        if (end == INDEX_NOT_FOUND)
+        const size_t needleSize = needle.size();
+        if (needleSize > Detail::twoWayThreshold)
         {
-            break;
+            m_Factorization = Detail::computeTwoWayFactorization<ignoreCase>(needle.data(), needleSize);
         }
 
-        list.emplace_back(source.data(), end);
-        source.remove_prefix(end + 1);
+#if STRINGUTILS_HAS_SIMD
+        if (Detail::isConstantEvaluated()) // the runtime searches use the simd filter
+#endif
+        {
+            const uint8_t defaultSkip = static_cast<uint8_t>(std::min<size_t>(needleSize, 255));
+            for (size_t j = 0; j < 256; ++j)
+            {
+                m_Skip[j] = defaultSkip;
+            }
+            for (size_t j = 0; j + 1 < needleSize; ++j)
+            {
+                m_Skip[Detail::foldChar<ignoreCase>(needle[j])] = static_cast<uint8_t>(std::min<size_t>(needleSize - 1 - j, 255));
+            }
+        }
+
+        size_t rank1 = SIZE_MAX;
+        for (size_t j = 0; j < needleSize; ++j)
+        {
+            const size_t rank = Detail::charFrequencyRank(static_cast<char>(Detail::foldChar<ignoreCase>(needle[j])));
+            if (rank < rank1)
+            {
+                rank1 = rank;
+                m_RareOffset1 = j;
+            }
+        }
+        m_RareOffset2 = m_RareOffset1;
+        size_t rank2 = SIZE_MAX;
+        for (size_t j = 0; j < needleSize; ++j)
+        { // prefer a second char that differs from the first, else any other position
+            const size_t rank = Detail::charFrequencyRank(static_cast<char>(Detail::foldChar<ignoreCase>(needle[j])))
+                                + ((Detail::foldChar<ignoreCase>(needle[j]) == Detail::foldChar<ignoreCase>(needle[m_RareOffset1])) ? 256 : 0);
+            if (j != m_RareOffset1 && rank < rank2)
+            {
+                rank2 = rank;
+                m_RareOffset2 = j;
+            }
+        }
     }
-    list.emplace_back(source.data(), source.size());
-    return list;
-}
 
-template<class StringOrStringView, class StringView>
-[[nodiscard]] inline std::vector<StringOrStringView> splitAnyBut(StringView source, const StringView separators, const size_t maxSplits)
-{
-    std::vector<StringOrStringView> list;
-    for (size_t splits = 0; splits < maxSplits; ++splits)
+    [[nodiscard]] constexpr std::string_view needle() const noexcept
     {
-        const size_t end = source.find_first_not_of(separators, 0);
-        if (end == INDEX_NOT_FOUND)
+        return m_Needle;
+    }
+
+    [[nodiscard]] constexpr size_t find(const std::string_view hayStack, const size_t startIndex = 0) const noexcept
+    {
+        const size_t haySize = hayStack.size();
+        const size_t needleSize = m_Needle.size();
+        if (needleSize > haySize || startIndex > haySize - needleSize)
         {
-            break;
+            return INDEX_NOT_FOUND;
         }
 
-        list.emplace_back(source.data(), end);
-        source.remove_prefix(end + 1);
-    }
-    list.emplace_back(source.data(), source.size());
-    return list;
-}
+        if (needleSize == 0)
+        {
+            return startIndex;
+        }
 
+        if (needleSize > Detail::twoWayThreshold)
+        {
+            Detail::LazyTwoWay<ignoreCase> twoWay(m_Factorization);
+            return Detail::findLongNeedle<ignoreCase>(hayStack.data(), haySize, startIndex, m_Needle.data(), needleSize, m_RareOffset1, m_RareOffset2, twoWay);
+        }
 
-template<class StringOrStringView, class StringView, size_t maxSplits>
-[[nodiscard]] inline STRINGUTILS_NAMESPACE::SplitResult<StringOrStringView, maxSplits> splitAnyBut(StringView source, const StringView separators)
-{
-    STRINGUTILS_NAMESPACE::SplitResult<StringOrStringView, maxSplits> result;
-    size_t splits = 0;
-    for (; splits < maxSplits; ++splits)
-    {
-        const size_t end = source.find_first_not_of(separators, 0);
-        if (end == INDEX_NOT_FOUND)
+#if STRINGUTILS_HAS_SIMD
+        if (!Detail::isConstantEvaluated())
         {
-            break;
+            const char* const match = ignoreCase
+                ? Detail::Simd::Dispatch::iFindSubstring(hayStack.data() + startIndex, haySize - startIndex, m_Needle.data(), needleSize, m_RareOffset1, m_RareOffset2)
+                : Detail::Simd::Dispatch::findSubstring(hayStack.data() + startIndex, haySize - startIndex, m_Needle.data(), needleSize, m_RareOffset1, m_RareOffset2);
+            return (match != nullptr) ? static_cast<size_t>(match - hayStack.data()) : INDEX_NOT_FOUND;
         }
-        assign(result.parts[splits], source.data(), end);
-        source.remove_prefix(end + 1);
+#endif
+        return horspoolFind(hayStack.data(), haySize, startIndex);
     }
-    assign(result.parts[splits], source.data(), source.size());
-    return result;
-}
 
-
-template<class StringOrStringView, class StringView>
-[[nodiscard]] inline std::vector<StringOrStringView> splitSkipEmpty(StringView source, const StringView separator)
-{
-    const size_t separatorSize = separator.size();
-    if (separatorSize == 0)
+    [[nodiscard]] constexpr bool contains(const std::string_view hayStack) const noexcept
     {
-        return Detail::splitNoSeparatorSkipEmpty<StringOrStringView>(source);
+        return find(hayStack, 0) != INDEX_NOT_FOUND;
     }
-    std::vector<StringOrStringView> list;
-    for (;;)
+
+    /**
+    * Counts the non overlapping occurrences of the needle, an empty needle matches hayStack.size() + 1 times
+    */
+    [[nodiscard]] constexpr size_t count(const std::string_view hayStack) const noexcept
     {
-        const size_t end = source.find(separator, 0);
-        if (end == INDEX_NOT_FOUND)
+        const size_t needleSize = m_Needle.size();
+        if (needleSize == 0)
         {
-            break;
+            return hayStack.size() + 1;
         }
-
-        if (end != 0)
+        size_t matches = 0;
+        for (size_t position = find(hayStack, 0); position != INDEX_NOT_FOUND; position = find(hayStack, position + needleSize))
         {
-            list.emplace_back(source.data(), end);
+            ++matches;
         }
-        source.remove_prefix(end + separatorSize);
+        return matches;
     }
-    if (!source.empty())
+
+    /**
+    * Same as StringUtils::split(source, needle())
+    */
+    [[nodiscard]] std::vector<std::string_view> split(const std::string_view source) const
     {
-        list.emplace_back(source.data(), source.size());
+        return split(source, INDEX_NOT_FOUND);
     }
-    return list;
-}
 
-template<class StringOrStringView, class StringView>
-[[nodiscard]] inline std::vector<StringOrStringView> splitSkipEmpty(StringView source, const char separator)
-{
-    std::vector<StringOrStringView> list;
-    for (;;)
+    /**
+    * Same as StringUtils::split(source, needle(), maxSplits)
+    */
+    [[nodiscard]] std::vector<std::string_view> split(const std::string_view source, const size_t maxSplits) const
     {
-        const size_t end = source.find(separator, 0);
-        if (end == INDEX_NOT_FOUND)
+        const SplitView<Detail::SearcherSeparator<BasicSearcher>, false> view(source, Detail::SearcherSeparator<BasicSearcher>{ this }, maxSplits);
+        return std::vector<std::string_view>(view.begin(), view.end());
+    }
+
+  private:
+    constexpr size_t horspoolFind(const char* const hayStack, const size_t haySize, const size_t startIndex) const noexcept
+    {
+        const size_t needleSize = m_Needle.size();
+        const size_t lastOffset = needleSize - 1;
+        const uchar lastChar = Detail::foldChar<ignoreCase>(m_Needle[lastOffset]);
+        for (size_t position = startIndex; position <= haySize - needleSize;)
         {
-            break;
+            const uchar c = Detail::foldChar<ignoreCase>(hayStack[position + lastOffset]);
+            if (c == lastChar && matchesAt(hayStack + position, lastOffset))
+            {
+                return position;
+            }
+            position += m_Skip[c];
         }
+        return INDEX_NOT_FOUND;
+    }
 
-        if (end != 0)
+    constexpr bool matchesAt(const char* const position, const size_t size) const noexcept
+    {
+        if constexpr (ignoreCase)
         {
-            list.emplace_back(source.data(), end);
+            return Detail::iEquals(position, m_Needle.data(), size);
+        }
+        else
+        {
+            return Detail::equals(position, m_Needle.data(), size);
         }
-        source.remove_prefix(end + 1);
     }
-    if (!source.empty())
+};
+
+
+//#######################################################################################
+//
+//                                      MultiSearcher
+//
+//#######################################################################################
+
+
+struct MultiMatch
+{
+    size_t position = INDEX_NOT_FOUND;
+    size_t size = 0;
+    size_t needleIndex = INDEX_NOT_FOUND;
+};
+
+
+template<bool ignoreCase>
+class BasicMultiSearcher
+{ // Aho-Corasick automaton with a dense transition table over byte classes
+  private:
+    static constexpr uint32_t noNeedle = UINT32_MAX;
+
+    std::array<uint16_t, 256> m_ByteClasses = {}; // bytes that occur in no needle share class 0
+    size_t m_ClassCount = 1;
+    std::vector<uint32_t> m_Transitions;  // m_Transitions[state * m_ClassCount + byteClass] => next state
+    std::vector<uint32_t> m_Needles;      // needle that ends exactly at each state
+    std::vector<uint32_t> m_LongestMatch; // longest needle that is a suffix of each state
+    std::vector<uint32_t> m_MatchLinks;   // next shorter suffix state with a needle, 0 if there is none
+    std::vector<uint32_t> m_Depths;       // length of the needle prefix each state stands for
+    std::vector<size_t> m_NeedleSizes;
+
+  public:
+    explicit BasicMultiSearcher(const std::initializer_list<std::string_view> needles)
     {
-        list.emplace_back(source.data(), source.size());
+        build(needles.begin(), needles.end());
     }
-    return list;
-}
 
+    template<class Container>
+    explicit BasicMultiSearcher(const Container& needles)
+    {
+        build(std::begin(needles), std::end(needles));
+    }
 
-template<class StringOrStringView, class StringView>
-[[nodiscard]] inline std::vector<StringOrStringView> splitSkipEmpty(StringView source, const StringView separator, const size_t maxSplits)
-{
-    const size_t separatorSize = separator.size();
-    if (separatorSize == 0)
+    [[nodiscard]] size_t needleCount() const noexcept
     {
-        return Detail::splitNoSeparatorSkipEmpty<StringOrStringView>(source);
+        return m_NeedleSizes.size();
     }
-    std::vector<StringOrStringView> list;
-    for (size_t splits = 0; splits < maxSplits; ++splits)
+
+    /**
+    * Returns the leftmost match, the longest one if several needles start there
+    * After the first match the scan goes on while the state can still lead to a match that starts at or before it:
+    * a later match starts at or after position + 1 - depth of the state, and that bound never decreases
+    */
+    [[nodiscard]] MultiMatch find(const std::string_view hayStack, const size_t startIndex = 0) const noexcept
     {
-        const size_t end = source.find(separator, 0);
-        if (end == INDEX_NOT_FOUND)
+        MultiMatch best;
+        uint32_t state = 0;
+        for (size_t position = startIndex; position < hayStack.size(); ++position)
         {
-            break;
+            state = nextState(state, hayStack[position]);
+            if (best.position != INDEX_NOT_FOUND && position + 1 - m_Depths[state] > best.position)
+            {
+                break;
+            }
+            const uint32_t needle = m_LongestMatch[state];
+            if (needle != noNeedle)
+            { // the longest needle ending here is the one that starts first
+                const MultiMatch match = makeMatch(position + 1, needle);
+                if (match.position < best.position || (match.position == best.position && match.size > best.size))
+                {
+                    best = match;
+                }
+            }
         }
+        return best;
+    }
 
-        if (end != 0)
+    [[nodiscard]] bool contains(const std::string_view hayStack) const noexcept
+    {
+        return find(hayStack, 0).position != INDEX_NOT_FOUND;
+    }
+
+    /**
+    * Writes all (also overlapping) matches ordered by their end position to output
+    */
+    template<class OutputIterator>
+    OutputIterator findAll(const std::string_view hayStack, OutputIterator output) const
+    {
+        uint32_t state = 0;
+        for (size_t position = 0; position < hayStack.size(); ++position)
         {
-            list.emplace_back(source.data(), end);
+            state = nextState(state, hayStack[position]);
+            if (m_LongestMatch[state] == noNeedle)
+            {
+                continue;
+            }
+            for (uint32_t matchState = (m_Needles[state] != noNeedle) ? state : m_MatchLinks[state]; matchState != 0; matchState = m_MatchLinks[matchState])
+            {
+                *output = makeMatch(position + 1, m_Needles[matchState]);
+                ++output;
+            }
         }
-        source.remove_prefix(end + separatorSize);
+        return output;
     }
-    if (!source.empty())
+
+    [[nodiscard]] std::vector<MultiMatch> findAll(const std::string_view hayStack) const
     {
-        list.emplace_back(source.data(), source.size());
+        std::vector<MultiMatch> matches;
+        findAll(hayStack, std::back_inserter(matches));
+        return matches;
     }
-    return list;
-}
 
-template<class StringOrStringView, class StringView>
-[[nodiscard]] inline std::vector<StringOrStringView> splitSkipEmpty(StringView source, const char separator, const size_t maxSplits)
-{
-    std::vector<StringOrStringView> list;
-    for (size_t splits = 0; splits < maxSplits; ++splits)
+  private:
+    uint32_t nextState(const uint32_t state, const char c) const noexcept
     {
-        const size_t end = source.find(separator, 0);
-        if (end == INDEX_NOT_FOUND)
+        return m_Transitions[state * m_ClassCount + m_ByteClasses[static_cast<uchar>(c)]];
+    }
+
+    MultiMatch makeMatch(const size_t end, const uint32_t needle) const noexcept
+    {
+        MultiMatch match;
+        match.size = m_NeedleSizes[needle];
+        match.position = end - match.size;
+        match.needleIndex = needle;
+        return match;
+    }
+
+    template<class Iterator>
+    void build(const Iterator begin, const Iterator end)
+    {
+        for (Iterator needle = begin; needle != end; ++needle)
         {
-            break;
+            for (const char c : std::string_view(*needle))
+            {
+                const uchar folded = Detail::foldChar<ignoreCase>(c);
+                if (m_ByteClasses[folded] == 0)
+                {
+                    m_ByteClasses[folded] = static_cast<uint16_t>(m_ClassCount++);
+                }
+            }
+        }
+        if constexpr (ignoreCase)
+        {
+            for (size_t c = 'A'; c <= 'Z'; ++c)
+            {
+                m_ByteClasses[c] = m_ByteClasses[c - 'A' + 'a'];
+            }
         }
 
-        if (end != 0)
+        // trie, 0 in m_Transitions means no child (the root is never a child)
+        m_Transitions.assign(m_ClassCount, 0);
+        m_Needles.assign(1, noNeedle);
+        m_Depths.assign(1, 0);
+        for (Iterator needle = begin; needle != end; ++needle)
         {
-            list.emplace_back(source.data(), end);
+            const std::string_view needleView(*needle);
+            const uint32_t needleIndex = static_cast<uint32_t>(m_NeedleSizes.size());
+            m_NeedleSizes.push_back(needleView.size());
+            if (needleView.empty())
+            { // empty needles never match
+                continue;
+            }
+            uint32_t state = 0;
+            for (const char c : needleView)
+            {
+                uint32_t& child = m_Transitions[state * m_ClassCount + m_ByteClasses[static_cast<uchar>(c)]];
+                if (child == 0)
+                {
+                    child = static_cast<uint32_t>(m_Needles.size());
+                    m_Needles.push_back(noNeedle);
+                    m_Depths.push_back(m_Depths[state] + 1);
+                    m_Transitions.resize(m_Transitions.size() + m_ClassCount, 0);
+                }
+                state = m_Transitions[state * m_ClassCount + m_ByteClasses[static_cast<uchar>(c)]]; // resize may have invalidated child
+            }
+            if (m_Needles[state] == noNeedle)
+            { // duplicate needles are reported with the index of the first one
+                m_Needles[state] = needleIndex;
+            }
+        }
+
+        // breadth first over the trie: complete the transitions with the failure links
+        const size_t stateCount = m_Needles.size();
+        std::vector<uint32_t> failureLinks(stateCount, 0);
+        m_LongestMatch.assign(stateCount, noNeedle);
+        m_MatchLinks.assign(stateCount, 0);
+        std::vector<uint32_t> queue;
+        queue.reserve(stateCount);
+        queue.push_back(0);
+        for (size_t next = 0; next < queue.size(); ++next)
+        {
+            const uint32_t state = queue[next];
+            const uint32_t failure = failureLinks[state];
+            m_LongestMatch[state] = (m_Needles[state] != noNeedle) ? m_Needles[state] : m_LongestMatch[failure];
+            m_MatchLinks[state] = (m_Needles[failure] != noNeedle) ? failure : m_MatchLinks[failure];
+            for (size_t byteClass = 0; byteClass < m_ClassCount; ++byteClass)
+            {
+                uint32_t& target = m_Transitions[state * m_ClassCount + byteClass];
+                const uint32_t failureTarget = (state == 0) ? 0 : m_Transitions[failure * m_ClassCount + byteClass];
+                if (target == 0)
+                {
+                    target = failureTarget;
+                }
+                else
+                {
+                    failureLinks[target] = failureTarget;
+                    queue.push_back(target);
+                }
+            }
         }
-        source.remove_prefix(end + 1);
     }
-    if (!source.empty())
+};
+
+
+//#######################################################################################
+//
+//                                      Hash
+//
+//#######################################################################################
+
+
+struct Hash128
+{
+    uint64_t low = 0;
+    uint64_t high = 0;
+
+    [[nodiscard]] constexpr bool operator==(const Hash128& other) const noexcept
     {
-        list.emplace_back(source.data(), source.size());
+        return low == other.low && high == other.high;
     }
-    return list;
-}
 
-template<class StringOrStringView, class StringView, size_t maxSplits>
-[[nodiscard]] inline STRINGUTILS_NAMESPACE::SplitResult<StringOrStringView, maxSplits> splitSkipEmpty(StringView source, const StringView separator)
+    [[nodiscard]] constexpr bool operator!=(const Hash128& other) const noexcept
+    {
+        return !(*this == other);
+    }
+};
+
+
+namespace Detail {
+/**
+* 64 x 64 => 128 bit multiplication, a gets the low and b the high half
+*/
+constexpr inline void multiply128(uint64_t& a, uint64_t& b) noexcept
 {
-    const size_t separatorSize = separator.size();
-    if (separatorSize == 0)
+#if defined(__SIZEOF_INT128__)
+    const __uint128_t product = static_cast<__uint128_t>(a) * b;
+    a = static_cast<uint64_t>(product);
+    b = static_cast<uint64_t>(product >> 64);
+#else
+#    if defined(STRINGUTILS_MSVC_COMPILER) && defined(_M_X64)
+    if (!isConstantEvaluated())
     {
-        return Detail::splitNoSeparatorSkipEmpty<StringOrStringView, maxSplits>(source);
+        a = _umul128(a, b, &b);
+        return;
     }
+#    endif
+    const uint64_t aHigh = a >> 32;
+    const uint64_t bHigh = b >> 32;
+    const uint64_t aLow = static_cast<uint32_t>(a);
+    const uint64_t bLow = static_cast<uint32_t>(b);
+    const uint64_t middle1 = aHigh * bLow;
+    const uint64_t middle2 = bHigh * aLow;
+    const uint64_t low1 = aLow * bLow + (middle1 << 32);
+    const uint64_t low2 = low1 + (middle2 << 32);
+    const uint64_t carry = (low1 < (middle1 << 32)) + (low2 < low1);
+    b = aHigh * bHigh + (middle1 >> 32) + (middle2 >> 32) + carry;
+    a = low2;
+#endif
+}
 
-    STRINGUTILS_NAMESPACE::SplitResult<StringOrStringView, maxSplits> result;
-    size_t position = 0;
-    for (size_t splits = 0; splits < maxSplits; ++splits)
+constexpr inline uint64_t hashMix(uint64_t a, uint64_t b) noexcept
+{
+    multiply128(a, b);
+    return a ^ b;
+}
+
+/**
+* Lower cases the ascii letters of the 8 bytes in word at once
+*/
+constexpr inline uint64_t foldWord(const uint64_t word) noexcept
+{
+    constexpr uint64_t ones = 0x0101010101010101;
+    const uint64_t heptets = word & (ones * 0x7F);
+    const uint64_t atLeastA = heptets + ones * (0x80 - 'A');     // high bit set for the bytes >= 'A'
+    const uint64_t aboveZ = heptets + ones * (0x80 - 'Z' - 1);   // high bit set for the bytes > 'Z'
+    const uint64_t upper = atLeastA & ~aboveZ & ~word & (ones * 0x80);
+    return word | (upper >> 2);
+}
+
+/**
+* Little endian loads, the compilers merge them into single loads
+*/
+template<size_t bytes>
+constexpr inline uint64_t hashRead(const char* const ptr) noexcept
+{
+    uint64_t word = 0;
+    for (size_t i = 0; i < bytes; ++i)
     {
-        const size_t end = source.find(separator, 0);
-        if (end == INDEX_NOT_FOUND)
-        {
-            break;
-        }
-        if (end != 0)
-        {
-            assign(result.parts[position++], source.data(), end);
-        }
-        source.remove_prefix(end + separatorSize);
+        word |= static_cast<uint64_t>(static_cast<uchar>(ptr[i])) << (8 * i);
     }
-    if (!source.empty())
+    return word;
+}
+
+template<bool ignoreCase, size_t bytes>
+constexpr inline uint64_t hashWord(const char* const ptr) noexcept
+{
+    const uint64_t word = hashRead<bytes>(ptr);
+    return ignoreCase ? foldWord(word) : word;
+}
+
+static constexpr uint64_t hashSecret[4] = { 0xa0761d6478bd642f, 0xe7037ed1a0b428db, 0x8ebc6af09c88c6e3, 0x589965cc75374cc3 };
+
+constexpr inline uint64_t hashSeed(const uint64_t seed) noexcept
+{
+    return seed ^ hashMix(seed ^ hashSecret[0], hashSecret[1]);
+}
+
+constexpr inline uint64_t hashFinish(uint64_t a, uint64_t b, const uint64_t seed, const size_t size) noexcept
+{
+    a ^= hashSecret[1];
+    b ^= seed;
+    multiply128(a, b);
+    return hashMix(a ^ hashSecret[0] ^ size, b ^ hashSecret[1]);
+}
+
+/**
+* One 48 byte step of the three independent lanes used for inputs longer than 48 bytes
+*/
+template<bool ignoreCase>
+constexpr inline void hashBlock(const char* const ptr, uint64_t& seed, uint64_t& seed1, uint64_t& seed2) noexcept
+{
+    seed = hashMix(hashWord<ignoreCase, 8>(ptr) ^ hashSecret[1], hashWord<ignoreCase, 8>(ptr + 8) ^ seed);
+    seed1 = hashMix(hashWord<ignoreCase, 8>(ptr + 16) ^ hashSecret[2], hashWord<ignoreCase, 8>(ptr + 24) ^ seed1);
+    seed2 = hashMix(hashWord<ignoreCase, 8>(ptr + 32) ^ hashSecret[3], hashWord<ignoreCase, 8>(ptr + 40) ^ seed2);
+}
+
+/**
+* Hashes the last 1 to 48 bytes of an input longer than 16 bytes
+* The last 16 bytes are read unaligned, so up to 15 bytes before ptr are read as well (they belong to the input)
+*/
+template<bool ignoreCase>
+constexpr inline uint64_t hashTail(const char* ptr, size_t remaining, const size_t size, uint64_t seed) noexcept
+{
+    while (remaining > 16)
     {
-        assign(result.parts[position++], source.data(), source.size());
+        seed = hashMix(hashWord<ignoreCase, 8>(ptr) ^ hashSecret[1], hashWord<ignoreCase, 8>(ptr + 8) ^ seed);
+        ptr += 16;
+        remaining -= 16;
     }
-    result.size = position;
-    return result;
+    return hashFinish(hashWord<ignoreCase, 8>(ptr + remaining - 16), hashWord<ignoreCase, 8>(ptr + remaining - 8), seed, size);
 }
 
-template<class StringOrStringView, class StringView, size_t maxSplits>
-[[nodiscard]] inline STRINGUTILS_NAMESPACE::SplitResult<StringOrStringView, maxSplits> splitSkipEmpty(StringView source, const char separator)
+/**
+* 64 bit hash of [ptr, ptr + size) in the style of wyhash (multiply and fold 16 or 48 bytes per step)
+* With ignoreCase the ascii letters are lower cased while they are read, so iEquals strings hash equally
+* The values are part of the interface (see hash64), changing them breaks persisted hashes
+*/
+template<bool ignoreCase>
+constexpr inline uint64_t hash(const char* ptr, const size_t size, uint64_t seed) noexcept
 {
-    STRINGUTILS_NAMESPACE::SplitResult<StringOrStringView, maxSplits> result;
-    size_t position = 0;
-    for (size_t splits = 0; splits < maxSplits; ++splits)
+    seed = hashSeed(seed);
+    if (size <= 16)
     {
-        const size_t end = source.find(separator, 0);
-        if (end == INDEX_NOT_FOUND)
+        uint64_t a = 0;
+        uint64_t b = 0;
+        if (size >= 4)
         {
-            break;
+            const size_t middle = (size >> 3) << 2;
+            a = (hashWord<ignoreCase, 4>(ptr) << 32) | hashWord<ignoreCase, 4>(ptr + middle);
+            b = (hashWord<ignoreCase, 4>(ptr + size - 4) << 32) | hashWord<ignoreCase, 4>(ptr + size - 4 - middle);
         }
-        if (end != 0)
+        else if (size > 0)
         {
-            assign(result.parts[position++], source.data(), end);
+            a = (hashWord<ignoreCase, 1>(ptr) << 16) | (hashWord<ignoreCase, 1>(ptr + (size >> 1)) << 8) | hashWord<ignoreCase, 1>(ptr + size - 1);
         }
-        source.remove_prefix(end + 1);
+        return hashFinish(a, b, seed, size);
     }
-    if (!source.empty())
+
+    size_t remaining = size;
+    if (remaining > 48)
     {
-        assign(result.parts[position++], source.data(), source.size());
+        uint64_t seed1 = seed;
+        uint64_t seed2 = seed;
+        do
+        {
+            hashBlock<ignoreCase>(ptr, seed, seed1, seed2);
+            ptr += 48;
+            remaining -= 48;
+        } while (remaining > 48);
+        seed ^= seed1 ^ seed2;
     }
-    result.size = position;
-    return result;
+    return hashTail<ignoreCase>(ptr, remaining, size, seed);
+}
+
+/**
+* Two 64 bit hashes with unrelated seeds
+*/
+template<bool ignoreCase>
+constexpr inline Hash128 hash128(const char* const ptr, const size_t size, const uint64_t seed) noexcept
+{
+    return Hash128{ hash<ignoreCase>(ptr, size, seed), hash<ignoreCase>(ptr, size, seed ^ hashSecret[2]) };
 }
+} // namespace Detail
 
 
-template<class StringOrStringView, class StringView>
-[[nodiscard]] inline std::vector<StringOrStringView> splitAnyOfSkipEmpty(StringView source, const StringView separators)
+struct Hash
 {
-    if (separators.size() == 0)
+    using is_transparent = void;
+
+    [[nodiscard]] constexpr size_t operator()(const std::string_view str) const noexcept
     {
-        return constructSingleElementVector<StringOrStringView>(source);
+        return static_cast<size_t>(Detail::hash<false>(str.data(), str.size(), 0));
     }
-    std::vector<StringOrStringView> list;
-    for (;;)
+};
+
+struct IHash
+{
+    using is_transparent = void;
+
+    [[nodiscard]] constexpr size_t operator()(const std::string_view str) const noexcept
     {
-        const size_t end = source.find_first_of(separators, 0);
-        if (end == INDEX_NOT_FOUND)
-        {
-            break;
-        }
+        return static_cast<size_t>(Detail::hash<true>(str.data(), str.size(), 0));
+    }
+};
 
-        if (end != 0)
-        {
-            list.emplace_back(source.data(), end);
-        }
-        source.remove_prefix(end + 1);
+struct Equal
+{
+    using is_transparent = void;
+
+    [[nodiscard]] constexpr bool operator()(const std::string_view str1, const std::string_view str2) const noexcept
+    {
+        return str1 == str2;
     }
-    if (!source.empty())
+};
+
+struct IEqual
+{
+    using is_transparent = void;
+
+    [[nodiscard]] constexpr bool operator()(const std::string_view str1, const std::string_view str2) const noexcept
     {
-        list.emplace_back(source.data(), source.size());
+        return str1.size() == str2.size() && Detail::iEquals(str1.data(), str2.data(), str1.size());
     }
-    return list;
-}
+};
 
 
-template<class StringOrStringView, class StringView>
-[[nodiscard]] inline std::vector<StringOrStringView> splitAnyOfSkipEmpty(StringView source, const StringView separators, const size_t maxSplits)
-{
-    if (separators.size() == 0)
+template<bool ignoreCase>
+class BasicHasher
+{ // keeps the last 48 bytes back so the digest of the chunks equals the one shot hash of their concatenation
+  private:
+    static constexpr size_t s_HistorySize = 16;
+    static constexpr size_t s_BlockSize = 48;
+
+    char m_Buffer[s_HistorySize + s_BlockSize] = {}; // the last 16 bytes of the hashed blocks followed by the pending bytes
+    size_t m_PendingSize = 0;
+    size_t m_Size = 0;
+    uint64_t m_Seed = 0;
+    uint64_t m_Lanes[3] = {};
+
+  public:
+    constexpr explicit BasicHasher(const uint64_t seed = 0) noexcept
     {
-        return constructSingleElementVector<StringOrStringView>(source);
+        reset(seed);
     }
-    std::vector<StringOrStringView> list;
-    for (size_t splits = 0; splits < maxSplits; ++splits)
+
+    constexpr void reset(const uint64_t seed = 0) noexcept
     {
-        const size_t end = source.find_first_of(separators, 0);
-        if (end == INDEX_NOT_FOUND)
+        m_PendingSize = 0;
+        m_Size = 0;
+        m_Seed = seed;
+        m_Lanes[0] = m_Lanes[1] = m_Lanes[2] = Detail::hashSeed(seed);
+    }
+
+    constexpr BasicHasher& update(const std::string_view data) noexcept
+    {
+        const char* ptr = data.data();
+        size_t size = data.size();
+        m_Size += size;
+        while (size > 0)
         {
-            break;
+            if (m_PendingSize == s_BlockSize)
+            { // more bytes follow, so the pending block is not part of the tail
+                Detail::hashBlock<ignoreCase>(m_Buffer + s_HistorySize, m_Lanes[0], m_Lanes[1], m_Lanes[2]);
+                copy(m_Buffer + s_BlockSize, s_HistorySize, m_Buffer);
+                m_PendingSize = 0;
+            }
+            if (m_PendingSize == 0 && size > s_BlockSize)
+            { // hash large chunks in place
+                do
+                {
+                    Detail::hashBlock<ignoreCase>(ptr, m_Lanes[0], m_Lanes[1], m_Lanes[2]);
+                    ptr += s_BlockSize;
+                    size -= s_BlockSize;
+                } while (size > s_BlockSize);
+                copy(ptr - s_HistorySize, s_HistorySize, m_Buffer);
+            }
+            const size_t chunkSize = std::min(s_BlockSize - m_PendingSize, size);
+            copy(ptr, chunkSize, m_Buffer + s_HistorySize + m_PendingSize);
+            m_PendingSize += chunkSize;
+            ptr += chunkSize;
+            size -= chunkSize;
         }
+        return *this;
+    }
 
-        if (end != 0)
-        {
-            list.emplace_back(source.data(), end);
+    [[nodiscard]] constexpr uint64_t digest() const noexcept
+    {
+        if (m_Size <= s_BlockSize)
+        { // nothing was hashed yet, all bytes are pending
+            return Detail::hash<ignoreCase>(m_Buffer + s_HistorySize, m_Size, m_Seed);
         }
-        source.remove_prefix(end + 1);
+        return Detail::hashTail<ignoreCase>(m_Buffer + s_HistorySize, m_PendingSize, m_Size, m_Lanes[0] ^ m_Lanes[1] ^ m_Lanes[2]);
     }
-    if (!source.empty())
+
+    [[nodiscard]] constexpr size_t size() const noexcept
     {
-        list.emplace_back(source.data(), source.size());
+        return m_Size;
     }
-    return list;
+
+  private:
+    static constexpr void copy(const char* const source, const size_t size, char* const destination) noexcept
+    {
+        for (size_t i = 0; i < size; ++i)
+        {
+            destination[i] = source[i];
+        }
+    }
+};
+
+
+//#######################################################################################
+//
+//                                      Batch
+//
+//#######################################################################################
+
+
+namespace Detail {
+inline void prefetch(const void* const ptr) noexcept
+{
+#if defined(STRINGUTILS_GNU_COMPILER) || defined(STRINGUTILS_CLANG_COMPILER)
+    __builtin_prefetch(ptr);
+#elif STRINGUTILS_HAS_SSE2
+    _mm_prefetch(static_cast<const char*>(ptr), _MM_HINT_T0);
+#else
+    static_cast<void>(ptr);
+#endif
 }
 
+/**
+* How many hayStacks ahead the data of the next hayStack is prefetched
+*/
+static constexpr size_t batchPrefetchDistance{ 4 };
 
-template<class StringOrStringView, class StringView, size_t maxSplits>
-[[nodiscard]] inline STRINGUTILS_NAMESPACE::SplitResult<StringOrStringView, maxSplits> splitAnyOfSkipEmpty(StringView source, const StringView separators)
+/**
+* Sets bit i % 64 of matches[i / 64] to predicate(hayStacks[i]) for the hayStacks in [firstWord * 64, lastWord * 64)
+*/
+template<class Predicate>
+inline void batchWords(const std::string_view* const hayStacks, const size_t count, uint64_t* const matches, const size_t firstWord, const size_t lastWord, const Predicate& predicate)
 {
-    STRINGUTILS_NAMESPACE::SplitResult<StringOrStringView, maxSplits> result;
-    if (separators.size() == 0)
+    for (size_t word = firstWord; word != lastWord; ++word)
     {
-        assign(result.parts[0], source.data(), source.size());
-        result.size = 1;
-        return result;
+        const size_t first = word * 64;
+        const size_t last = std::min(count, first + 64);
+        uint64_t bits = 0;
+        for (size_t index = first; index != last; ++index)
+        {
+            if (index + batchPrefetchDistance < count)
+            {
+                prefetch(hayStacks[index + batchPrefetchDistance].data());
+            }
+            bits |= static_cast<uint64_t>(predicate(hayStacks[index])) << (index - first);
+        }
+        matches[word] = bits;
     }
-    size_t position = 0;
-    for (size_t splits = 0; splits < maxSplits; ++splits)
+}
+
+/**
+* Tests every hayStack with predicate and writes the results as a bitset of (count + 63) / 64 words to matches
+* With threadCount > 1 every thread gets a chunk of whole words, so no two threads write to the same word
+*/
+template<class Predicate>
+inline void batch(const std::string_view* const hayStacks, const size_t count, uint64_t* const matches, size_t threadCount, const Predicate& predicate)
+{
+    const size_t wordCount = (count + 63) / 64;
+#ifndef STRINGUTILS_NO_THREADS
+    threadCount = std::min(threadCount, wordCount);
+    if (threadCount > 1)
     {
-        const size_t end = source.find_first_of(separators, 0);
-        if (end == INDEX_NOT_FOUND)
+        std::vector<std::thread> threads;
+        threads.reserve(threadCount - 1);
+        const size_t wordsPerThread = wordCount / threadCount;
+        const size_t extraWords = wordCount % threadCount;
+        size_t firstWord = 0;
+        for (size_t thread = 0; thread + 1 < threadCount; ++thread)
         {
-            break;
+            const size_t lastWord = firstWord + wordsPerThread + (thread < extraWords);
+            threads.emplace_back([=, &predicate]() { batchWords(hayStacks, count, matches, firstWord, lastWord, predicate); });
+            firstWord = lastWord;
         }
-
-        if (end != 0)
+        batchWords(hayStacks, count, matches, firstWord, wordCount, predicate);
+        for (std::thread& thread : threads)
         {
-            assign(result.parts[position++], source.data(), end);
+            thread.join();
         }
-        source.remove_prefix(end + 1);
-    }
-    if (!source.empty())
-    {
-        assign(result.parts[position++], source.data(), source.size());
+        return;
     }
-    result.size = position;
-    return result;
+#else
+    static_cast<void>(threadCount);
+#endif
+    batchWords(hayStacks, count, matches, 0, wordCount, predicate);
 }
+} // namespace Detail
 
 
-template<class StringOrStringView, class StringView>
-[[nodiscard]] inline std::vector<StringOrStringView> splitAnyButSkipEmpty(StringView source, const StringView separators)
+//#######################################################################################
+//
+//                                      Parallel split
+//
+//#######################################################################################
+
+
+enum class ParallelSchedule
 {
-    std::vector<StringOrStringView> list;
+    Static, // one chunk per thread
+    Dynamic // many small chunks, a thread that is done takes the next one
+};
+
+
+namespace Detail {
+/**
+* Smallest chunk parallelSplit hands to a thread
+*/
+static constexpr size_t parallelSplitMinChunk{ 1 << 16 };
+
+/**
+* Chunks per thread of ParallelSchedule::Dynamic
+*/
+static constexpr size_t parallelSplitDynamicChunks{ 16 };
+
+/**
+* Index of the first occurrence of separator starting in [position, limit) that split cuts at as well, INDEX_NOT_FOUND if there is none
+* An occurrence that no other occurrence overlaps from the left is always a cut of split, whatever comes before it.
+* For separators that can not overlap themselves (e.g. single chars) that is every occurrence.
+*/
+inline size_t parallelSplitCut(const std::string_view source, const std::string_view separator, size_t position, const size_t limit) noexcept
+{
+    const size_t separatorSize = separator.size();
+    const size_t searchSize = std::min(source.size(), limit + separatorSize - 1);
     for (;;)
     {
-        const size_t end = source.find_first_not_of(separators, 0);
-        if (end == INDEX_NOT_FOUND)
+        const size_t match = find(source.data(), searchSize, position, separator.data(), separatorSize);
+        if (match == INDEX_NOT_FOUND)
         {
-            break;
+            return INDEX_NOT_FOUND;
         }
-
-        if (end != 0)
+        bool overlapped = false;
+        for (size_t start = (match >= separatorSize) ? match - separatorSize + 1 : 0; start < match && !overlapped; ++start)
         {
-            list.emplace_back(source.data(), end);
+            overlapped = (std::memcmp(source.data() + start, separator.data(), separatorSize) == 0);
         }
-        source.remove_prefix(end + 1);
-    }
-    if (!source.empty())
-    {
-        list.emplace_back(source.data(), source.size());
+        if (!overlapped)
+        {
+            return match;
+        }
+        position = match + 1;
     }
-    return list;
 }
 
-template<class StringOrStringView, class StringView>
-[[nodiscard]] inline std::vector<StringOrStringView> splitAnyButSkipEmpty(StringView source, const StringView separators, const size_t maxSplits)
+#ifndef STRINGUTILS_NO_THREADS
+/**
+* Runs task(i) for every i in [0, taskCount) on threadCount threads, each thread takes the next task from a shared counter
+*/
+template<class Task>
+inline void parallelFor(const size_t taskCount, const size_t threadCount, const Task& task)
 {
-    std::vector<StringOrStringView> list;
-    for (size_t splits = 0; splits < maxSplits; ++splits)
-    {
-        const size_t end = source.find_first_not_of(separators, 0);
-        if (end == INDEX_NOT_FOUND)
-        {
-            break;
-        }
-
-        if (end != 0)
+    std::atomic<size_t> nextTask{ 0 };
+    const auto worker = [&nextTask, taskCount, &task]() {
+        for (size_t i = nextTask++; i < taskCount; i = nextTask++)
         {
-            list.emplace_back(source.data(), end);
+            task(i);
         }
-        source.remove_prefix(end + 1);
+    };
+    std::vector<std::thread> threads;
+    threads.reserve(threadCount - 1);
+    for (size_t thread = 1; thread < threadCount; ++thread)
+    {
+        threads.emplace_back(worker);
     }
-    if (!source.empty())
+    worker();
+    for (std::thread& thread : threads)
     {
-        list.emplace_back(source.data(), source.size());
+        thread.join();
     }
-    return list;
 }
+#endif
 
-template<class StringOrStringView, class StringView, size_t maxSplits>
-[[nodiscard]] inline STRINGUTILS_NAMESPACE::SplitResult<StringOrStringView, maxSplits> splitAnyButSkipEmpty(StringView source, const StringView separators)
+/**
+* Splits source like split on threadCount threads
+* The source is cut into chunks at nominal positions, each cut is moved forward to the next occurrence of separator that split
+* cuts at too (see parallelSplitCut). The cuts are found once up front, a chunk without such an occurrence is merged into the
+* previous one. Every chunk is then split on its own and the parts are copied together in order.
+*/
+template<class Separator>
+inline std::vector<std::string_view> parallelSplit(const std::string_view source, const Separator separator, const std::string_view separatorChars, size_t threadCount, const ParallelSchedule schedule)
 {
-    STRINGUTILS_NAMESPACE::SplitResult<StringOrStringView, maxSplits> result;
-    size_t position = 0;
-    for (size_t splits = 0; splits < maxSplits; ++splits)
+#ifndef STRINGUTILS_NO_THREADS
+    threadCount = std::min(threadCount, source.size() / parallelSplitMinChunk);
+    if (threadCount > 1 && !separatorChars.empty())
     {
-        const size_t end = source.find_first_not_of(separators, 0);
-        if (end == INDEX_NOT_FOUND)
+        size_t chunkCount = (schedule == ParallelSchedule::Dynamic) ? std::min(threadCount * parallelSplitDynamicChunks, source.size() / parallelSplitMinChunk) : threadCount;
+        const size_t separatorSize = separatorChars.size();
+        const auto nominalStart = [&source, chunkCount](const size_t chunk) { return source.size() / chunkCount * chunk; };
+
+        std::vector<size_t> cuts; // the index of the separator in front of every chunk but the first
+        cuts.reserve(chunkCount - 1);
+        for (size_t chunk = 1; chunk < chunkCount; ++chunk)
         {
-            break;
+            const size_t cut = parallelSplitCut(source, separatorChars, nominalStart(chunk), (chunk + 1 < chunkCount) ? nominalStart(chunk + 1) : source.size());
+            if (cut != INDEX_NOT_FOUND)
+            {
+                cuts.push_back(cut);
+            }
         }
 
-        if (end != 0)
+        chunkCount = cuts.size() + 1;
+        std::vector<std::vector<std::string_view>> chunkParts(chunkCount);
+        parallelFor(chunkCount, threadCount, [&](const size_t chunk) {
+            const size_t begin = (chunk == 0) ? 0 : cuts[chunk - 1] + separatorSize;
+            const size_t end = (chunk < cuts.size()) ? cuts[chunk] : source.size();
+            chunkParts[chunk] = split<std::string_view, std::string_view>(std::string_view(source.data() + begin, end - begin), separator);
+        });
+
+        std::vector<size_t> offsets(chunkCount + 1, 0);
+        for (size_t chunk = 0; chunk < chunkCount; ++chunk)
         {
-            assign(result.parts[position++], source.data(), end);
+            offsets[chunk + 1] = offsets[chunk] + chunkParts[chunk].size();
         }
-        source.remove_prefix(end + 1);
-    }
-    if (!source.empty())
-    {
-        assign(result.parts[position++], source.data(), source.size());
+        std::vector<std::string_view> parts(offsets[chunkCount]);
+        parallelFor(chunkCount, threadCount, [&](const size_t chunk) { std::copy(chunkParts[chunk].begin(), chunkParts[chunk].end(), parts.begin() + static_cast<std::ptrdiff_t>(offsets[chunk])); });
+        return parts;
     }
-    result.size = position;
-    return result;
+#else
+    static_cast<void>(separatorChars);
+    static_cast<void>(threadCount);
+#endif
+    static_cast<void>(schedule);
+    return split<std::string_view, std::string_view>(source, separator);
 }
-
-
 } // namespace Detail
 
 
@@ -1876,6 +4593,29 @@ struct AlwaysFalse: std::false_type
 {
 };
 
+template<class T>
+struct is_wide_char: std::false_type
+{
+};
+template<>
+struct is_wide_char<wchar_t>: std::true_type
+{
+};
+template<>
+struct is_wide_char<char16_t>: std::true_type
+{
+};
+template<>
+struct is_wide_char<char32_t>: std::true_type
+{
+};
+#ifdef __cpp_char8_t
+template<>
+struct is_wide_char<char8_t>: std::true_type
+{
+};
+#endif
+
 
 // Struct nonesuch taken from https://en.cppreference.com/w/cpp/experimental/nonesuch
 struct nonesuch
@@ -2041,6 +4781,115 @@ inline std::string toString(const T& value)
 
 } // namespace Detail
 
+
+//#######################################################################################
+//
+//                                      splitAs
+//
+//#######################################################################################
+
+
+namespace Custom { // Namespace for custom parsers of splitAs fields, bool operator()(std::string_view field, T& value) const
+template<typename T>
+struct fromStringImpl
+{
+};
+} // namespace Custom
+
+namespace Detail {
+
+template<class T>
+using custom_fromString_t = decltype(std::declval<STRINGUTILS_NAMESPACE::Custom::fromStringImpl<T>>().operator()(std::declval<std::string_view>(), std::declval<T&>()));
+
+template<class T>
+using has_custom_fromString = TypeTraits::is_detected<custom_fromString_t, T>;
+
+/**
+* Parses the whole field into value, returns false if the field is not a valid T or has chars left over
+* Numbers use std::from_chars (no leading whitespace or '+'), bools are "true"/"false"/"1"/"0" and chars must be exactly one char
+* wchar_t, char16_t, char32_t and char8_t are integral but not numbers, they need a Custom::fromStringImpl like any other type
+* Without a floating point std::from_chars floats go through std::strtold, which uses the decimal point of the current C locale
+*/
+template<class T>
+inline bool parseField(const std::string_view field, T& value)
+{
+    if constexpr (has_custom_fromString<T>::value)
+    {
+        constexpr Custom::fromStringImpl<T> impl;
+        return impl(field, value);
+    }
+    else if constexpr (std::is_same<T, std::string_view>::value || std::is_same<T, std::string>::value)
+    {
+        value = T(field);
+        return true;
+    }
+    else if constexpr (std::is_same<T, char>::value)
+    {
+        value = field.empty() ? '\0' : field[0];
+        return field.size() == 1;
+    }
+    else if constexpr (std::is_same<T, bool>::value)
+    {
+        value = (field == "true" || field == "1");
+        return value || field == "false" || field == "0";
+    }
+    else if constexpr (std::is_integral<T>::value && !TypeTraits::is_wide_char<T>::value)
+    {
+        const auto [end, error] = std::from_chars(field.data(), field.data() + field.size(), value);
+        return error == std::errc() && end == field.data() + field.size();
+    }
+    else if constexpr (std::is_floating_point<T>::value)
+    {
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+        const auto [end, error] = std::from_chars(field.data(), field.data() + field.size(), value);
+        return error == std::errc() && end == field.data() + field.size();
+#else // no floating point from_chars, strtold is locale dependent, needs a null terminated copy and skips leading whitespace
+        if (field.empty() || field.size() > 63 || field[0] == ' ' || (field[0] >= '\t' && field[0] <= '\r'))
+        {
+            return false;
+        }
+        char buffer[64];
+        std::memcpy(buffer, field.data(), field.size());
+        buffer[field.size()] = '\0';
+        char* end = nullptr;
+        value = static_cast<T>(std::strtold(buffer, &end));
+        return end == buffer + field.size();
+#endif
+    }
+    else
+    {
+        static_assert(TypeTraits::AlwaysFalse<T>::value, "splitAs has no parser for this type, specialize Custom::fromStringImpl");
+        return false;
+    }
+}
+
+/**
+* Takes one field per type, the last field has to reach the end of source, so the arity must match exactly
+* The fields are parsed as soon as they are found, && short circuits on the first failure
+*/
+template<class... Types, class Separator, size_t... indices>
+inline std::optional<std::tuple<Types...>> splitAs(std::string_view source, const Separator& separator, std::index_sequence<indices...>)
+{
+    static_assert(sizeof...(Types) > 0, "splitAs needs at least one type");
+    std::tuple<Types...> values;
+    const auto parseNext = [&source, &separator](auto& value, const size_t splits) {
+        const size_t index = separator.find(source, splits);
+        if ((index == INDEX_NOT_FOUND) != (splits + 1 == sizeof...(Types)))
+        {
+            return false;
+        }
+        const std::string_view field = source.substr(0, index);
+        source.remove_prefix((index == INDEX_NOT_FOUND) ? source.size() : index + separator.size());
+        return parseField(field, value);
+    };
+    if ((parseNext(std::get<indices>(values), indices) && ...))
+    {
+        return values;
+    }
+    return std::nullopt;
+}
+} // namespace Detail
+
 } // namespace STRINGUTILS_NAMESPACE
 
 
@@ -0,0 +1,627 @@
+#ifndef STRINGUTILS_SIMD_HPP
+#define STRINGUTILS_SIMD_HPP
+
+/**
+* Simd kernels used by the runtime (non constant evaluated) paths of StringUtilsPrivate.hpp
+* The kernels are compiled for sse2, avx2 and avx512bw and Dispatch picks the best one the cpu supports (cpuid, once).
+* Define STRINGUTILS_NO_SIMD to only use the scalar implementations
+* Define STRINGUTILS_NO_SIMD_DISPATCH to only compile the kernels enabled by the compiler flags (e.g. -mavx2)
+* Define STRINGUTILS_FORCE_ISA to Sse2, Avx2 or Avx512 to skip the detection (e.g. for benchmarks), the cpu must support it
+*/
+
+#if !defined(STRINGUTILS_NO_SIMD) && STRINGUTILS_HAS_IS_CONSTANT_EVALUATED && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#    define STRINGUTILS_HAS_SSE2 1
+#    include <emmintrin.h>
+#else
+#    define STRINGUTILS_HAS_SSE2 0
+#endif
+
+#if STRINGUTILS_HAS_SSE2 && (defined(__SSSE3__) || defined(__AVX__))
+#    define STRINGUTILS_HAS_SSSE3 1
+#    include <tmmintrin.h>
+#else
+#    define STRINGUTILS_HAS_SSSE3 0
+#endif
+
+// kernels for instruction sets the compiler flags do not enable are compiled with target pragmas
+#if STRINGUTILS_HAS_SSE2 && !defined(STRINGUTILS_NO_SIMD_DISPATCH) && (defined(STRINGUTILS_GNU_COMPILER) || defined(STRINGUTILS_CLANG_COMPILER) || defined(STRINGUTILS_MSVC_COMPILER))
+#    define STRINGUTILS_SIMD_DISPATCH 1
+#else
+#    define STRINGUTILS_SIMD_DISPATCH 0
+#endif
+
+#if STRINGUTILS_HAS_SSE2 && (defined(__AVX2__) || STRINGUTILS_SIMD_DISPATCH)
+#    define STRINGUTILS_HAS_AVX2 1
+#    include <immintrin.h>
+#else
+#    define STRINGUTILS_HAS_AVX2 0
+#endif
+
+#if STRINGUTILS_HAS_AVX2 && (defined(__AVX512BW__) || STRINGUTILS_SIMD_DISPATCH)
+#    define STRINGUTILS_HAS_AVX512 1
+#else
+#    define STRINGUTILS_HAS_AVX512 0
+#endif
+
+#define STRINGUTILS_HAS_SIMD STRINGUTILS_HAS_SSE2
+
+// char class kernels (findAnyOf and friends) need a byte shuffle, Dispatch falls back to a scalar loop on cpus without one
+#define STRINGUTILS_HAS_SIMD_CLASSIFY (STRINGUTILS_HAS_SSSE3 || STRINGUTILS_HAS_AVX2)
+
+#if STRINGUTILS_HAS_SIMD && defined(STRINGUTILS_MSVC_COMPILER)
+#    include <intrin.h>
+#endif
+
+#if STRINGUTILS_HAS_SIMD && defined(__PCLMUL__) && defined(__x86_64__)
+#    define STRINGUTILS_HAS_PCLMUL 1
+#    include <wmmintrin.h>
+#else
+#    define STRINGUTILS_HAS_PCLMUL 0
+#endif
+
+
+#if STRINGUTILS_HAS_SIMD
+namespace STRINGUTILS_NAMESPACE {
+namespace Detail {
+namespace Simd {
+
+inline unsigned trailingZeros(const uint32_t mask) noexcept
+{
+#    if defined(STRINGUTILS_MSVC_COMPILER)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return static_cast<unsigned>(index);
+#    else
+    return static_cast<unsigned>(__builtin_ctz(mask));
+#    endif
+}
+
+inline unsigned trailingZeros(const uint64_t mask) noexcept
+{
+#    if defined(STRINGUTILS_MSVC_COMPILER)
+    unsigned long index;
+    _BitScanForward64(&index, mask);
+    return static_cast<unsigned>(index);
+#    else
+    return static_cast<unsigned>(__builtin_ctzll(mask));
+#    endif
+}
+
+inline unsigned highestBit(const uint32_t mask) noexcept
+{
+#    if defined(STRINGUTILS_MSVC_COMPILER)
+    unsigned long index;
+    _BitScanReverse(&index, mask);
+    return static_cast<unsigned>(index);
+#    else
+    return 31 - static_cast<unsigned>(__builtin_clz(mask));
+#    endif
+}
+
+inline unsigned highestBit(const uint64_t mask) noexcept
+{
+#    if defined(STRINGUTILS_MSVC_COMPILER)
+    unsigned long index;
+    _BitScanReverse64(&index, mask);
+    return static_cast<unsigned>(index);
+#    else
+    return 63 - static_cast<unsigned>(__builtin_clzll(mask));
+#    endif
+}
+
+inline uint32_t clearLowestBit(const uint32_t mask) noexcept
+{
+    return mask & (mask - 1);
+}
+
+inline uint64_t clearLowestBit(const uint64_t mask) noexcept
+{
+    return mask & (mask - 1);
+}
+
+inline unsigned popCount(const uint32_t mask) noexcept
+{
+#    if defined(STRINGUTILS_MSVC_COMPILER) // __popcnt needs the popcnt instruction, which is not part of sse2
+    uint32_t bits = mask - ((mask >> 1) & 0x55555555u);
+    bits = (bits & 0x33333333u) + ((bits >> 2) & 0x33333333u);
+    return static_cast<unsigned>((((bits + (bits >> 4)) & 0x0F0F0F0Fu) * 0x01010101u) >> 24);
+#    else
+    return static_cast<unsigned>(__builtin_popcount(mask));
+#    endif
+}
+
+inline unsigned popCount(const uint64_t mask) noexcept
+{
+#    if defined(STRINGUTILS_MSVC_COMPILER)
+    return popCount(static_cast<uint32_t>(mask)) + popCount(static_cast<uint32_t>(mask >> 32));
+#    else
+    return static_cast<unsigned>(__builtin_popcountll(mask));
+#    endif
+}
+
+/**
+* Bit i of the result is the xor of the bits [0, i] of mask, for a mask of quotes the bits inside the quoted regions are set
+* A carry-less multiplication with all ones if the compiler flags enable pclmul, else six shift-xor steps
+*/
+inline uint64_t prefixXor(uint64_t mask) noexcept
+{
+#    if STRINGUTILS_HAS_PCLMUL
+    return static_cast<uint64_t>(_mm_cvtsi128_si64(_mm_clmulepi64_si128(_mm_set_epi64x(0, static_cast<long long>(mask)), _mm_set1_epi8(-1), 0)));
+#    else
+    mask ^= mask << 1;
+    mask ^= mask << 2;
+    mask ^= mask << 4;
+    mask ^= mask << 8;
+    mask ^= mask << 16;
+    mask ^= mask << 32;
+    return mask;
+#    endif
+}
+
+/**
+* Bit i of the result is set if the char at i follows an odd run of escape chars (bits of escapes), i.e. is escaped
+* carry is 1 if the first char is escaped by the previous block, it is updated for the next block (simdjson's branchless scan)
+*/
+inline uint64_t escapedMask(uint64_t escapes, uint64_t& carry) noexcept
+{
+    constexpr uint64_t evenBits = 0x5555555555555555;
+    escapes &= ~carry; // an escaped escape char escapes nothing
+    const uint64_t followsEscape = (escapes << 1) | carry;
+    const uint64_t oddStarts = escapes & ~evenBits & ~followsEscape;
+    const uint64_t evenStartRuns = oddStarts + escapes; // the runs starting on odd bits are carried out of the run
+    carry = (evenStartRuns < oddStarts) ? 1 : 0;
+    return (evenBits ^ (evenStartRuns << 1)) & followsEscape;
+}
+
+/**
+* Case folding for the case insensitive kernels: (c | foldMask(needle)) == (needle | foldMask(needle)) matches c case insensitively
+*/
+constexpr inline char foldMask(const char c) noexcept
+{
+    return (static_cast<uchar>((c | 0x20) - 'a') < 26) ? 0x20 : 0x00;
+}
+
+/**
+* Scalar lookup in a 32 byte char class table, see CharSet for the layout
+*/
+inline bool inCharClass(const uint8_t* const table, const char c) noexcept
+{
+    const uchar u = static_cast<uchar>(c);
+    return (table[(u & 0x0F) | ((u >> 3) & 0x10)] >> ((u >> 4) & 0x07)) & 1;
+}
+
+
+namespace Sse2 {
+using Vector = __m128i;
+using Mask = uint32_t;
+constexpr size_t width = 16;
+constexpr Mask fullMask = 0xFFFF;
+
+inline Vector load(const char* const ptr) noexcept { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr)); }
+inline Vector broadcast(const char c) noexcept { return _mm_set1_epi8(c); }
+inline Mask equalMask(const Vector a, const Vector b) noexcept { return static_cast<Mask>(_mm_movemask_epi8(_mm_cmpeq_epi8(a, b))); }
+inline Vector bitOr(const Vector a, const Vector b) noexcept { return _mm_or_si128(a, b); }
+
+/**
+* Adds 0x20 to the bytes in 'A' - 'Z', they are shifted to -128 - -103 so a signed compare finds them
+*/
+inline Vector toLowerCase(const Vector input) noexcept
+{
+    const Vector shifted = _mm_add_epi8(input, _mm_set1_epi8(static_cast<char>(0x80 - 'A')));
+    const Vector upper = _mm_cmplt_epi8(shifted, _mm_set1_epi8(static_cast<char>(0x80 + 26)));
+    return _mm_or_si128(input, _mm_and_si128(upper, _mm_set1_epi8(0x20)));
+}
+
+#    if STRINGUTILS_HAS_SSSE3
+#        define STRINGUTILS_SIMD_CLASSIFY 1
+struct ClassTables
+{
+    Vector low;  // rows of the chars 0x00 - 0x7F indexed by the low nibble
+    Vector high; // rows of the chars 0x80 - 0xFF indexed by the low nibble
+    Vector bits; // bit of each high nibble within a row
+};
+
+inline ClassTables loadClassTables(const uint8_t* const table) noexcept
+{
+    ClassTables tables;
+    tables.low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(table));
+    tables.high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(table + 16));
+    tables.bits = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+    return tables;
+}
+
+/**
+* Sets the bit of each byte of input that is in the char class
+* pshufb returns 0 for indices with the most significant bit set, so the chars >= 0x80 only hit the high rows
+*/
+inline Mask classMask(const Vector input, const ClassTables& tables) noexcept
+{
+    const Vector index = _mm_and_si128(input, _mm_set1_epi8(static_cast<char>(0x8F)));
+    const Vector row = _mm_or_si128(_mm_shuffle_epi8(tables.low, index), _mm_shuffle_epi8(tables.high, _mm_xor_si128(index, _mm_set1_epi8(static_cast<char>(0x80)))));
+    const Vector bit = _mm_shuffle_epi8(tables.bits, _mm_and_si128(_mm_srli_epi16(input, 4), _mm_set1_epi8(0x0F)));
+    return equalMask(_mm_and_si128(row, bit), bit);
+}
+#    else
+#        define STRINGUTILS_SIMD_CLASSIFY 0
+#    endif
+
+#    include "StringUtilsSimdKernels.ipp"
+#    undef STRINGUTILS_SIMD_CLASSIFY
+} // namespace Sse2
+
+
+#    if STRINGUTILS_HAS_AVX2
+#        if !defined(__AVX2__) && defined(STRINGUTILS_GNU_COMPILER)
+#            pragma GCC push_options
+#            pragma GCC target("avx2")
+#        elif !defined(__AVX2__) && defined(STRINGUTILS_CLANG_COMPILER)
+#            pragma clang attribute push(__attribute__((target("avx2"))), apply_to = function)
+#        endif
+namespace Avx2 {
+using Vector = __m256i;
+using Mask = uint32_t;
+constexpr size_t width = 32;
+constexpr Mask fullMask = 0xFFFFFFFF;
+
+inline Vector load(const char* const ptr) noexcept { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr)); }
+inline Vector broadcast(const char c) noexcept { return _mm256_set1_epi8(c); }
+inline Mask equalMask(const Vector a, const Vector b) noexcept { return static_cast<Mask>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(a, b))); }
+inline Vector bitOr(const Vector a, const Vector b) noexcept { return _mm256_or_si256(a, b); }
+
+inline Vector toLowerCase(const Vector input) noexcept
+{
+    const Vector shifted = _mm256_add_epi8(input, _mm256_set1_epi8(static_cast<char>(0x80 - 'A')));
+    const Vector upper = _mm256_cmpgt_epi8(_mm256_set1_epi8(static_cast<char>(0x80 + 26)), shifted);
+    return _mm256_or_si256(input, _mm256_and_si256(upper, _mm256_set1_epi8(0x20)));
+}
+
+#        define STRINGUTILS_SIMD_CLASSIFY 1
+struct ClassTables
+{
+    Vector low;
+    Vector high;
+    Vector bits;
+};
+
+inline ClassTables loadClassTables(const uint8_t* const table) noexcept
+{
+    ClassTables tables;
+    tables.low = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(table)));
+    tables.high = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(table + 16)));
+    tables.bits = _mm256_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+    return tables;
+}
+
+inline Mask classMask(const Vector input, const ClassTables& tables) noexcept
+{
+    const Vector index = _mm256_and_si256(input, _mm256_set1_epi8(static_cast<char>(0x8F)));
+    const Vector row = _mm256_or_si256(_mm256_shuffle_epi8(tables.low, index), _mm256_shuffle_epi8(tables.high, _mm256_xor_si256(index, _mm256_set1_epi8(static_cast<char>(0x80)))));
+    const Vector bit = _mm256_shuffle_epi8(tables.bits, _mm256_and_si256(_mm256_srli_epi16(input, 4), _mm256_set1_epi8(0x0F)));
+    return equalMask(_mm256_and_si256(row, bit), bit);
+}
+
+#        include "StringUtilsSimdKernels.ipp"
+#        undef STRINGUTILS_SIMD_CLASSIFY
+} // namespace Avx2
+#        if !defined(__AVX2__) && defined(STRINGUTILS_GNU_COMPILER)
+#            pragma GCC pop_options
+#        elif !defined(__AVX2__) && defined(STRINGUTILS_CLANG_COMPILER)
+#            pragma clang attribute pop
+#        endif
+#    endif
+
+
+#    if STRINGUTILS_HAS_AVX512
+#        if !defined(__AVX512BW__) && defined(STRINGUTILS_GNU_COMPILER)
+#            pragma GCC push_options
+#            pragma GCC target("avx2,avx512f,avx512bw")
+#        elif !defined(__AVX512BW__) && defined(STRINGUTILS_CLANG_COMPILER)
+#            pragma clang attribute push(__attribute__((target("avx2,avx512f,avx512bw"))), apply_to = function)
+#        endif
+namespace Avx512 {
+using Vector = __m512i;
+using Mask = uint64_t;
+constexpr size_t width = 64;
+constexpr Mask fullMask = 0xFFFFFFFFFFFFFFFF;
+
+inline Vector load(const char* const ptr) noexcept { return _mm512_loadu_si512(ptr); }
+inline Vector broadcast(const char c) noexcept { return _mm512_set1_epi8(c); }
+inline Mask equalMask(const Vector a, const Vector b) noexcept { return static_cast<Mask>(_mm512_cmpeq_epi8_mask(a, b)); }
+inline Vector bitOr(const Vector a, const Vector b) noexcept { return _mm512_or_si512(a, b); }
+
+inline Vector toLowerCase(const Vector input) noexcept
+{
+    const __mmask64 upper = _mm512_cmplt_epu8_mask(_mm512_sub_epi8(input, _mm512_set1_epi8('A')), _mm512_set1_epi8(26));
+    return _mm512_mask_add_epi8(input, upper, input, _mm512_set1_epi8(0x20));
+}
+
+#        define STRINGUTILS_SIMD_CLASSIFY 1
+struct ClassTables
+{
+    Vector low;
+    Vector high;
+    Vector bits;
+};
+
+/**
+* Repeats 16 bytes in all four 128 bit lanes (_mm512_broadcast_i32x4 triggers -Wmaybe-uninitialized on GCC 12)
+*/
+inline Vector broadcastLanes(const uint8_t* const bytes) noexcept
+{
+    uint8_t lanes[64];
+    for (size_t lane = 0; lane < 64; lane += 16)
+    {
+        std::memcpy(lanes + lane, bytes, 16);
+    }
+    return _mm512_loadu_si512(lanes);
+}
+
+inline ClassTables loadClassTables(const uint8_t* const table) noexcept
+{
+    static constexpr uint8_t bits[16] = { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+    ClassTables tables;
+    tables.low = broadcastLanes(table);
+    tables.high = broadcastLanes(table + 16);
+    tables.bits = broadcastLanes(bits);
+    return tables;
+}
+
+inline Mask classMask(const Vector input, const ClassTables& tables) noexcept
+{
+    const Vector index = _mm512_and_si512(input, _mm512_set1_epi8(static_cast<char>(0x8F)));
+    const Vector row = _mm512_or_si512(_mm512_shuffle_epi8(tables.low, index), _mm512_shuffle_epi8(tables.high, _mm512_xor_si512(index, _mm512_set1_epi8(static_cast<char>(0x80)))));
+    const Vector bit = _mm512_shuffle_epi8(tables.bits, _mm512_and_si512(_mm512_srli_epi16(input, 4), _mm512_set1_epi8(0x0F)));
+    return static_cast<Mask>(_mm512_test_epi8_mask(row, bit));
+}
+
+#        include "StringUtilsSimdKernels.ipp"
+#        undef STRINGUTILS_SIMD_CLASSIFY
+} // namespace Avx512
+#        if !defined(__AVX512BW__) && defined(STRINGUTILS_GNU_COMPILER)
+#            pragma GCC pop_options
+#        elif !defined(__AVX512BW__) && defined(STRINGUTILS_CLANG_COMPILER)
+#            pragma clang attribute pop
+#        endif
+#    endif
+
+
+enum class Isa
+{
+    Sse2,
+    Avx2,
+    Avx512
+};
+
+/**
+* Best instruction set supported by the cpu and the os (avx state enabled in xcr0)
+*/
+inline Isa detectIsa() noexcept
+{
+#    if defined(STRINGUTILS_MSVC_COMPILER)
+    int info[4];
+    __cpuid(info, 0);
+    const int maxLeaf = info[0];
+    __cpuid(info, 1);
+    const bool osxsave = (info[2] >> 27) & 1;
+    if (maxLeaf < 7 || !osxsave)
+    {
+        return Isa::Sse2;
+    }
+    const unsigned long long xcr0 = _xgetbv(0);
+    if ((xcr0 & 0x06) != 0x06) // xmm and ymm state
+    {
+        return Isa::Sse2;
+    }
+    __cpuidex(info, 7, 0);
+    const bool avx2 = (info[1] >> 5) & 1;
+    const bool avx512 = ((info[1] >> 16) & 1) && ((info[1] >> 30) & 1) && (xcr0 & 0xE6) == 0xE6; // avx512f, avx512bw and the opmask and zmm state
+    return avx512 ? Isa::Avx512 : (avx2 ? Isa::Avx2 : Isa::Sse2);
+#    else
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw"))
+    {
+        return Isa::Avx512;
+    }
+    return __builtin_cpu_supports("avx2") ? Isa::Avx2 : Isa::Sse2;
+#    endif
+}
+
+/**
+* Instruction set of the kernels used at runtime, detected once
+*/
+inline Isa activeIsa() noexcept
+{
+#    if defined(STRINGUTILS_FORCE_ISA)
+    return Isa::STRINGUTILS_FORCE_ISA;
+#    elif defined(__AVX512BW__)
+    return Isa::Avx512;
+#    elif !STRINGUTILS_SIMD_DISPATCH && defined(__AVX2__)
+    return Isa::Avx2;
+#    elif !STRINGUTILS_SIMD_DISPATCH
+    return Isa::Sse2;
+#    else
+    static const Isa isa = detectIsa();
+    return isa;
+#    endif
+}
+
+
+#    if STRINGUTILS_HAS_AVX512
+#        define STRINGUTILS_DISPATCH_AVX512(call) \
+            case Isa::Avx512:                     \
+                return Avx512::call;
+#    else
+#        define STRINGUTILS_DISPATCH_AVX512(call)
+#    endif
+
+#    if STRINGUTILS_HAS_AVX2
+#        define STRINGUTILS_DISPATCH_AVX2(call) \
+            case Isa::Avx2:                     \
+                return Avx2::call;
+#    else
+#        define STRINGUTILS_DISPATCH_AVX2(call)
+#    endif
+
+#    define STRINGUTILS_DISPATCH(call)          \
+        switch (activeIsa())                    \
+        {                                       \
+            STRINGUTILS_DISPATCH_AVX512(call)   \
+            STRINGUTILS_DISPATCH_AVX2(call)     \
+            default:                            \
+                return Sse2::call;              \
+        }
+
+/**
+* Entry points of the kernels, each forwards to the kernel of activeIsa()
+*/
+namespace Dispatch {
+inline const char* findSubstring(const char* const hayStack, const size_t haySize, const char* const needle, const size_t needleSize) noexcept
+{
+    STRINGUTILS_DISPATCH(findSubstring(hayStack, haySize, needle, needleSize))
+}
+
+inline const char* findSubstring(const char* const hayStack, const size_t haySize, const char* const needle, const size_t needleSize, const size_t offset1, const size_t offset2) noexcept
+{
+    STRINGUTILS_DISPATCH(findSubstring(hayStack, haySize, needle, needleSize, offset1, offset2))
+}
+
+template<bool ignoreCase, class Visitor>
+inline void forEachCandidate(const char* const hayStack, const size_t haySize, const char* const needle, const size_t needleSize, const size_t offset1, const size_t offset2, Visitor& visitor)
+{
+    STRINGUTILS_DISPATCH(template forEachCandidate<ignoreCase>(hayStack, haySize, needle, needleSize, offset1, offset2, visitor))
+}
+
+inline const char* rFindSubstring(const char* const hayStack, const size_t haySize, const char* const needle, const size_t needleSize) noexcept
+{
+    STRINGUTILS_DISPATCH(rFindSubstring(hayStack, haySize, needle, needleSize))
+}
+
+inline const char* rFindChar(const char* const hayStack, const size_t haySize, const char needle) noexcept
+{
+    STRINGUTILS_DISPATCH(rFindChar(hayStack, haySize, needle))
+}
+
+inline size_t countChar(const char* const hayStack, const size_t haySize, const char needle) noexcept
+{
+    STRINGUTILS_DISPATCH(countChar(hayStack, haySize, needle))
+}
+
+template<class Visitor>
+inline void forEachChar(const char* const hayStack, const size_t haySize, const char needle, Visitor& visitor)
+{
+    STRINGUTILS_DISPATCH(forEachChar(hayStack, haySize, needle, visitor))
+}
+
+template<class Visitor>
+inline void forEachUnquoted(const char* const hayStack, const size_t haySize, const char separator, const char quote, const char escape, Visitor& visitor)
+{
+    STRINGUTILS_DISPATCH(forEachUnquoted(hayStack, haySize, separator, quote, escape, visitor))
+}
+
+inline const char* iFindChar(const char* const hayStack, const size_t haySize, const char needle) noexcept
+{
+    STRINGUTILS_DISPATCH(iFindChar(hayStack, haySize, needle))
+}
+
+inline const char* irFindChar(const char* const hayStack, const size_t haySize, const char needle) noexcept
+{
+    STRINGUTILS_DISPATCH(irFindChar(hayStack, haySize, needle))
+}
+
+inline const char* iFindSubstring(const char* const hayStack, const size_t haySize, const char* const needle, const size_t needleSize, const size_t offset1, const size_t offset2) noexcept
+{
+    STRINGUTILS_DISPATCH(iFindSubstring(hayStack, haySize, needle, needleSize, offset1, offset2))
+}
+
+inline const char* irFindSubstring(const char* const hayStack, const size_t haySize, const char* const needle, const size_t needleSize) noexcept
+{
+    STRINGUTILS_DISPATCH(irFindSubstring(hayStack, haySize, needle, needleSize))
+}
+
+inline size_t iMismatch(const char* const ptr1, const char* const ptr2, const size_t size) noexcept
+{
+    STRINGUTILS_DISPATCH(iMismatch(ptr1, ptr2, size))
+}
+
+
+#    if STRINGUTILS_HAS_SIMD_CLASSIFY
+#        if STRINGUTILS_HAS_SSSE3
+#            define STRINGUTILS_DISPATCH_CLASSIFY(call) STRINGUTILS_DISPATCH(call)
+#        else // sse2 has no byte shuffle
+#            define STRINGUTILS_DISPATCH_CLASSIFY(call) \
+                switch (activeIsa())                    \
+                {                                       \
+                    STRINGUTILS_DISPATCH_AVX512(call)   \
+                    STRINGUTILS_DISPATCH_AVX2(call)     \
+                    default:                            \
+                        break;                          \
+                }
+#        endif
+
+template<bool negate>
+inline const char* findCharClass(const char* const hayStack, const size_t haySize, const uint8_t* const table) noexcept
+{
+    STRINGUTILS_DISPATCH_CLASSIFY(template findCharClass<negate>(hayStack, haySize, table))
+    for (const char* position = hayStack; position != hayStack + haySize; ++position)
+    {
+        if (inCharClass(table, *position) != negate)
+        {
+            return position;
+        }
+    }
+    return nullptr;
+}
+
+template<bool negate>
+inline const char* rFindCharClass(const char* const hayStack, const size_t haySize, const uint8_t* const table) noexcept
+{
+    STRINGUTILS_DISPATCH_CLASSIFY(template rFindCharClass<negate>(hayStack, haySize, table))
+    for (const char* position = hayStack + haySize; position != hayStack;)
+    {
+        --position;
+        if (inCharClass(table, *position) != negate)
+        {
+            return position;
+        }
+    }
+    return nullptr;
+}
+
+inline size_t countCharClass(const char* const hayStack, const size_t haySize, const uint8_t* const table) noexcept
+{
+    STRINGUTILS_DISPATCH_CLASSIFY(countCharClass(hayStack, haySize, table))
+    size_t matches = 0;
+    for (const char* position = hayStack; position != hayStack + haySize; ++position)
+    {
+        matches += inCharClass(table, *position);
+    }
+    return matches;
+}
+
+template<bool negate, class Visitor>
+inline void forEachCharClass(const char* const hayStack, const size_t haySize, const uint8_t* const table, Visitor& visitor)
+{
+    STRINGUTILS_DISPATCH_CLASSIFY(template forEachCharClass<negate>(hayStack, haySize, table, visitor))
+    for (size_t index = 0; index < haySize; ++index)
+    {
+        if (inCharClass(table, hayStack[index]) != negate && !visitor(index))
+        {
+            return;
+        }
+    }
+}
+#        undef STRINGUTILS_DISPATCH_CLASSIFY
+#    endif
+} // namespace Dispatch
+
+#    undef STRINGUTILS_DISPATCH
+#    undef STRINGUTILS_DISPATCH_AVX2
+#    undef STRINGUTILS_DISPATCH_AVX512
+
+} // namespace Simd
+} // namespace Detail
+} // namespace STRINGUTILS_NAMESPACE
+#endif
+
+
+#endif // !STRINGUTILS_SIMD_HPP
@@ -0,0 +1,646 @@
+// No include guard: this file is included once per instruction set by StringUtilsSimd.hpp,
+// inside a namespace that provides Vector, Mask, width, fullMask, load, broadcast, equalMask, bitOr and toLowerCase
+// and if STRINGUTILS_SIMD_CLASSIFY is set also ClassTables, loadClassTables and classMask
+
+
+/**
+* Finds the first occurrence of needle in [hayStack, hayStack + haySize)
+* Compares the first and the last char of needle for a whole block of positions at once,
+* only positions where both chars match are verified.
+* Requires 2 <= needleSize <= haySize
+*/
+inline const char* findSubstring(const char* const hayStack, const size_t haySize, const char* const needle, const size_t needleSize) noexcept
+{
+    const size_t lastOffset = needleSize - 1;
+    const Vector first = broadcast(needle[0]);
+    const Vector last = broadcast(needle[lastOffset]);
+    const char* const end = hayStack + (haySize - lastOffset); // one past the last possible start of a match
+    const char* position = hayStack;
+    for (; static_cast<size_t>(end - position) >= width; position += width)
+    {
+        Mask mask = equalMask(first, load(position)) & equalMask(last, load(position + lastOffset));
+        for (; mask != 0; mask = clearLowestBit(mask))
+        {
+            const char* const candidate = position + trailingZeros(mask);
+            if (std::memcmp(candidate + 1, needle + 1, lastOffset - 1) == 0)
+            {
+                return candidate;
+            }
+        }
+    }
+    for (; position < end; ++position)
+    {
+        if (*position == needle[0] && std::memcmp(position + 1, needle + 1, lastOffset) == 0)
+        {
+            return position;
+        }
+    }
+    return nullptr;
+}
+
+
+/**
+* Finds the first occurrence of needle in [hayStack, hayStack + haySize)
+* Same as findSubstring but filters on the chars at offset1 and offset2 of needle, which should be the rarest ones
+* Requires 1 <= needleSize <= haySize and offset1, offset2 < needleSize
+*/
+inline const char* findSubstring(const char* const hayStack, const size_t haySize, const char* const needle, const size_t needleSize, const size_t offset1, const size_t offset2) noexcept
+{
+    const Vector char1 = broadcast(needle[offset1]);
+    const Vector char2 = broadcast(needle[offset2]);
+    const char* const end = hayStack + (haySize + 1 - needleSize); // one past the last possible start of a match
+    const char* position = hayStack;
+    for (; static_cast<size_t>(end - position) >= width; position += width)
+    {
+        Mask mask = equalMask(char1, load(position + offset1)) & equalMask(char2, load(position + offset2));
+        for (; mask != 0; mask = clearLowestBit(mask))
+        {
+            const char* const candidate = position + trailingZeros(mask);
+            if (std::memcmp(candidate, needle, needleSize) == 0)
+            {
+                return candidate;
+            }
+        }
+    }
+    for (; position < end; ++position)
+    {
+        if (position[offset1] == needle[offset1] && std::memcmp(position, needle, needleSize) == 0)
+        {
+            return position;
+        }
+    }
+    return nullptr;
+}
+
+
+/**
+* Calls visitor(index) for every start index in [0, haySize + 1 - needleSize) whose chars at offset1 and offset2 equal the ones of needle
+* (case insensitively if ignoreCase), in order, until it returns false. The visitor verifies the candidates.
+* Requires 1 <= needleSize <= haySize and offset1, offset2 < needleSize
+*/
+template<bool ignoreCase, class Visitor>
+inline void forEachCandidate(const char* const hayStack, const size_t haySize, const char* const needle, const size_t needleSize, const size_t offset1, const size_t offset2, Visitor& visitor)
+{
+    const char fold1 = ignoreCase ? foldMask(needle[offset1]) : '\0';
+    const char fold2 = ignoreCase ? foldMask(needle[offset2]) : '\0';
+    const char target1 = static_cast<char>(needle[offset1] | fold1);
+    const char target2 = static_cast<char>(needle[offset2] | fold2);
+    const Vector folds1 = broadcast(fold1);
+    const Vector folds2 = broadcast(fold2);
+    const Vector targets1 = broadcast(target1);
+    const Vector targets2 = broadcast(target2);
+    const char* const end = hayStack + (haySize + 1 - needleSize); // one past the last possible start of a match
+    const char* position = hayStack;
+    for (; static_cast<size_t>(end - position) >= width; position += width)
+    {
+        Mask mask = equalMask(targets1, bitOr(load(position + offset1), folds1)) & equalMask(targets2, bitOr(load(position + offset2), folds2));
+        for (; mask != 0; mask = clearLowestBit(mask))
+        {
+            if (!visitor(static_cast<size_t>(position - hayStack) + trailingZeros(mask)))
+            {
+                return;
+            }
+        }
+    }
+    for (; position < end; ++position)
+    {
+        if ((position[offset1] | fold1) == target1 && (position[offset2] | fold2) == target2 && !visitor(static_cast<size_t>(position - hayStack)))
+        {
+            return;
+        }
+    }
+}
+
+
+/**
+* Finds the last occurrence of needle in [hayStack, hayStack + haySize)
+* Same filter as findSubstring, the blocks are scanned from the end and the candidates from the highest bit.
+* Requires 2 <= needleSize <= haySize
+*/
+inline const char* rFindSubstring(const char* const hayStack, const size_t haySize, const char* const needle, const size_t needleSize) noexcept
+{
+    const size_t lastOffset = needleSize - 1;
+    const Vector first = broadcast(needle[0]);
+    const Vector last = broadcast(needle[lastOffset]);
+    const char* position = hayStack + (haySize - lastOffset); // one past the last possible start of a match
+    for (; static_cast<size_t>(position - hayStack) >= width;)
+    {
+        position -= width;
+        Mask mask = equalMask(first, load(position)) & equalMask(last, load(position + lastOffset));
+        while (mask != 0)
+        {
+            const unsigned bit = highestBit(mask);
+            if (std::memcmp(position + bit + 1, needle + 1, lastOffset - 1) == 0)
+            {
+                return position + bit;
+            }
+            mask ^= static_cast<Mask>(1) << bit;
+        }
+    }
+    while (position != hayStack)
+    {
+        --position;
+        if (*position == needle[0] && std::memcmp(position + 1, needle + 1, lastOffset) == 0)
+        {
+            return position;
+        }
+    }
+    return nullptr;
+}
+
+
+/**
+* Finds the last char in [hayStack, hayStack + haySize) that equals needle
+*/
+inline const char* rFindChar(const char* const hayStack, const size_t haySize, const char needle) noexcept
+{
+    const Vector needles = broadcast(needle);
+    const char* position = hayStack + haySize;
+    for (; static_cast<size_t>(position - hayStack) >= width;)
+    {
+        position -= width;
+        const Mask mask = equalMask(needles, load(position));
+        if (mask != 0)
+        {
+            return position + highestBit(mask);
+        }
+    }
+    while (position != hayStack)
+    {
+        --position;
+        if (*position == needle)
+        {
+            return position;
+        }
+    }
+    return nullptr;
+}
+
+
+/**
+* Counts the chars in [hayStack, hayStack + haySize) that equal needle
+* The last block overlaps the previous one, the bytes counted already are shifted out of its mask
+*/
+inline size_t countChar(const char* const hayStack, const size_t haySize, const char needle) noexcept
+{
+    size_t matches = 0;
+    if (haySize < width)
+    {
+        for (const char* position = hayStack; position != hayStack + haySize; ++position)
+        {
+            matches += (*position == needle);
+        }
+        return matches;
+    }
+
+    const Vector needles = broadcast(needle);
+    const char* position = hayStack;
+    for (; static_cast<size_t>(hayStack + haySize - position) >= width; position += width)
+    {
+        matches += popCount(equalMask(needles, load(position)));
+    }
+    const size_t remaining = static_cast<size_t>(hayStack + haySize - position);
+    if (remaining != 0)
+    {
+        matches += popCount(static_cast<Mask>(equalMask(needles, load(hayStack + haySize - width)) >> (width - remaining)));
+    }
+    return matches;
+}
+
+
+/**
+* Bit i of the result is set if block[i] equals the needle, a block is 64 chars whatever the vector width
+*/
+inline uint64_t charBlockMask(const char* const block, const Vector needles) noexcept
+{
+    uint64_t mask = 0;
+    for (size_t i = 0; i < 64; i += width)
+    {
+        mask |= static_cast<uint64_t>(equalMask(needles, load(block + i))) << i;
+    }
+    return mask;
+}
+
+
+/**
+* Calls visitor(index) for every char in [hayStack, hayStack + haySize) that equals needle, in order, until it returns false
+* Each 64 char block is turned into one bitmask first, the indices are then taken out of it with tzcnt/blsr
+* The last block overlaps the previous one, the bytes visited already are shifted out of its mask
+*/
+template<class Visitor>
+inline void forEachChar(const char* const hayStack, const size_t haySize, const char needle, Visitor& visitor)
+{
+    if (haySize < 64)
+    {
+        for (size_t index = 0; index < haySize; ++index)
+        {
+            if (hayStack[index] == needle && !visitor(index))
+            {
+                return;
+            }
+        }
+        return;
+    }
+
+    const Vector needles = broadcast(needle);
+    size_t offset = 0;
+    for (; haySize - offset >= 64; offset += 64)
+    {
+        for (uint64_t mask = charBlockMask(hayStack + offset, needles); mask != 0; mask = clearLowestBit(mask))
+        {
+            if (!visitor(offset + trailingZeros(mask)))
+            {
+                return;
+            }
+        }
+    }
+    const size_t remaining = haySize - offset;
+    if (remaining != 0)
+    {
+        for (uint64_t mask = charBlockMask(hayStack + haySize - 64, needles) >> (64 - remaining); mask != 0; mask = clearLowestBit(mask))
+        {
+            if (!visitor(offset + trailingZeros(mask)))
+            {
+                return;
+            }
+        }
+    }
+}
+
+
+/**
+* Calls visitor(index) for every separator in [hayStack, hayStack + haySize) that is neither quoted nor escaped, in order, until it returns false
+* The quoted regions are the prefix xor of the unescaped quotes, escape chars only count if escape != quote
+* The last partial block is copied to a zero padded buffer, the bits past the end are masked out
+*/
+template<class Visitor>
+inline void forEachUnquoted(const char* const hayStack, const size_t haySize, const char separator, const char quote, const char escape, Visitor& visitor)
+{
+    const Vector separators = broadcast(separator);
+    const Vector quotes = broadcast(quote);
+    const Vector escapes = broadcast(escape);
+    uint64_t escapedCarry = 0;
+    uint64_t insideCarry = 0; // all ones if the block starts inside quotes
+    char tail[64];
+    for (size_t offset = 0; offset < haySize; offset += 64)
+    {
+        const char* block = hayStack + offset;
+        uint64_t valid = ~uint64_t(0);
+        if (haySize - offset < 64)
+        {
+            std::memset(tail, 0, sizeof(tail));
+            std::memcpy(tail, block, haySize - offset);
+            block = tail;
+            valid = (uint64_t(1) << (haySize - offset)) - 1;
+        }
+        const uint64_t escaped = (escape != quote) ? escapedMask(charBlockMask(block, escapes) & valid, escapedCarry) : 0;
+        const uint64_t inside = prefixXor(charBlockMask(block, quotes) & valid & ~escaped) ^ insideCarry;
+        insideCarry = static_cast<uint64_t>(static_cast<int64_t>(inside) >> 63);
+        for (uint64_t mask = charBlockMask(block, separators) & valid & ~escaped & ~inside; mask != 0; mask = clearLowestBit(mask))
+        {
+            if (!visitor(offset + trailingZeros(mask)))
+            {
+                return;
+            }
+        }
+    }
+}
+
+
+/**
+* Finds the first char in [hayStack, hayStack + haySize) that equals needle case insensitively
+*/
+inline const char* iFindChar(const char* const hayStack, const size_t haySize, const char needle) noexcept
+{
+    const char fold = foldMask(needle);
+    const char target = static_cast<char>(needle | fold);
+    const Vector folds = broadcast(fold);
+    const Vector targets = broadcast(target);
+    const char* const end = hayStack + haySize;
+    const char* position = hayStack;
+    for (; static_cast<size_t>(end - position) >= width; position += width)
+    {
+        const Mask mask = equalMask(targets, bitOr(load(position), folds));
+        if (mask != 0)
+        {
+            return position + trailingZeros(mask);
+        }
+    }
+    for (; position < end; ++position)
+    {
+        if ((*position | fold) == target)
+        {
+            return position;
+        }
+    }
+    return nullptr;
+}
+
+
+/**
+* Finds the last char in [hayStack, hayStack + haySize) that equals needle case insensitively
+*/
+inline const char* irFindChar(const char* const hayStack, const size_t haySize, const char needle) noexcept
+{
+    const char fold = foldMask(needle);
+    const char target = static_cast<char>(needle | fold);
+    const Vector folds = broadcast(fold);
+    const Vector targets = broadcast(target);
+    const char* position = hayStack + haySize;
+    for (; static_cast<size_t>(position - hayStack) >= width;)
+    {
+        position -= width;
+        const Mask mask = equalMask(targets, bitOr(load(position), folds));
+        if (mask != 0)
+        {
+            return position + highestBit(mask);
+        }
+    }
+    while (position != hayStack)
+    {
+        --position;
+        if ((*position | fold) == target)
+        {
+            return position;
+        }
+    }
+    return nullptr;
+}
+
+
+/**
+* Finds the first case insensitive occurrence of needle in [hayStack, hayStack + haySize)
+* Filters on the folded chars at offset1 and offset2 of needle, only positions where both match are verified
+* Requires 1 <= needleSize <= haySize and offset1, offset2 < needleSize
+*/
+inline const char* iFindSubstring(const char* const hayStack, const size_t haySize, const char* const needle, const size_t needleSize, const size_t offset1, const size_t offset2) noexcept
+{
+    const char fold1 = foldMask(needle[offset1]);
+    const char fold2 = foldMask(needle[offset2]);
+    const char target1 = static_cast<char>(needle[offset1] | fold1);
+    const Vector folds1 = broadcast(fold1);
+    const Vector folds2 = broadcast(fold2);
+    const Vector targets1 = broadcast(target1);
+    const Vector targets2 = broadcast(static_cast<char>(needle[offset2] | fold2));
+    const char* const end = hayStack + (haySize + 1 - needleSize); // one past the last possible start of a match
+    const char* position = hayStack;
+    for (; static_cast<size_t>(end - position) >= width; position += width)
+    {
+        Mask mask = equalMask(targets1, bitOr(load(position + offset1), folds1)) & equalMask(targets2, bitOr(load(position + offset2), folds2));
+        for (; mask != 0; mask = clearLowestBit(mask))
+        {
+            const char* const candidate = position + trailingZeros(mask);
+            if (Detail::iEquals(candidate, needle, needleSize))
+            {
+                return candidate;
+            }
+        }
+    }
+    for (; position < end; ++position)
+    {
+        if ((position[offset1] | fold1) == target1 && Detail::iEquals(position, needle, needleSize))
+        {
+            return position;
+        }
+    }
+    return nullptr;
+}
+
+
+/**
+* Finds the last case insensitive occurrence of needle in [hayStack, hayStack + haySize)
+* Filters on the folded first and last char of needle
+* Requires 1 <= needleSize <= haySize
+*/
+inline const char* irFindSubstring(const char* const hayStack, const size_t haySize, const char* const needle, const size_t needleSize) noexcept
+{
+    const size_t lastOffset = needleSize - 1;
+    const char fold1 = foldMask(needle[0]);
+    const char fold2 = foldMask(needle[lastOffset]);
+    const char target1 = static_cast<char>(needle[0] | fold1);
+    const Vector folds1 = broadcast(fold1);
+    const Vector folds2 = broadcast(fold2);
+    const Vector targets1 = broadcast(target1);
+    const Vector targets2 = broadcast(static_cast<char>(needle[lastOffset] | fold2));
+    const char* position = hayStack + (haySize - lastOffset); // one past the last possible start of a match
+    for (; static_cast<size_t>(position - hayStack) >= width;)
+    {
+        position -= width;
+        Mask mask = equalMask(targets1, bitOr(load(position), folds1)) & equalMask(targets2, bitOr(load(position + lastOffset), folds2));
+        while (mask != 0)
+        {
+            const unsigned bit = highestBit(mask);
+            if (Detail::iEquals(position + bit, needle, needleSize))
+            {
+                return position + bit;
+            }
+            mask ^= static_cast<Mask>(1) << bit;
+        }
+    }
+    while (position != hayStack)
+    {
+        --position;
+        if ((*position | fold1) == target1 && Detail::iEquals(position, needle, needleSize))
+        {
+            return position;
+        }
+    }
+    return nullptr;
+}
+
+
+/**
+* Index of the first char where [ptr1, ptr1 + size) and [ptr2, ptr2 + size) differ case insensitively, size if there is none
+*/
+inline size_t iMismatch(const char* const ptr1, const char* const ptr2, const size_t size) noexcept
+{
+    size_t position = 0;
+    for (; size - position >= width; position += width)
+    {
+        const Mask mask = equalMask(toLowerCase(load(ptr1 + position)), toLowerCase(load(ptr2 + position))) ^ fullMask;
+        if (mask != 0)
+        {
+            return position + trailingZeros(mask);
+        }
+    }
+    for (; position != size; ++position)
+    {
+        if (Detail::charToLowerCase(ptr1[position]) != Detail::charToLowerCase(ptr2[position]))
+        {
+            return position;
+        }
+    }
+    return size;
+}
+
+
+#if STRINGUTILS_SIMD_CLASSIFY
+/**
+* Finds the first char in [hayStack, hayStack + haySize) that is in the char class (not in the char class if negate is set)
+* table is the 32 byte char class table (see CharSet)
+*/
+template<bool negate>
+inline const char* findCharClass(const char* const hayStack, const size_t haySize, const uint8_t* const table) noexcept
+{
+    if (haySize < width)
+    {
+        for (const char* position = hayStack; position != hayStack + haySize; ++position)
+        {
+            if (inCharClass(table, *position) != negate)
+            {
+                return position;
+            }
+        }
+        return nullptr;
+    }
+
+    const ClassTables tables = loadClassTables(table);
+    const char* const end = hayStack + haySize;
+    const char* position = hayStack;
+    for (;; position += width)
+    {
+        if (static_cast<size_t>(end - position) < width)
+        { // the last block overlaps the previous one, which had no match
+            if (position == end)
+            {
+                return nullptr;
+            }
+            position = end - width;
+        }
+        const Mask mask = classMask(load(position), tables) ^ (negate ? fullMask : 0);
+        if (mask != 0)
+        {
+            return position + trailingZeros(mask);
+        }
+        if (position == end - width)
+        {
+            return nullptr;
+        }
+    }
+}
+
+
+/**
+* Finds the last char in [hayStack, hayStack + haySize) that is in the char class (not in the char class if negate is set)
+*/
+template<bool negate>
+inline const char* rFindCharClass(const char* const hayStack, const size_t haySize, const uint8_t* const table) noexcept
+{
+    if (haySize < width)
+    {
+        for (const char* position = hayStack + haySize; position != hayStack;)
+        {
+            --position;
+            if (inCharClass(table, *position) != negate)
+            {
+                return position;
+            }
+        }
+        return nullptr;
+    }
+
+    const ClassTables tables = loadClassTables(table);
+    const char* position = hayStack + haySize;
+    while (position != hayStack)
+    {
+        // the first block overlaps the next one, which had no match
+        position = (static_cast<size_t>(position - hayStack) >= width) ? position - width : hayStack;
+        const Mask mask = classMask(load(position), tables) ^ (negate ? fullMask : 0);
+        if (mask != 0)
+        {
+            return position + highestBit(mask);
+        }
+    }
+    return nullptr;
+}
+
+
+/**
+* Counts the chars in [hayStack, hayStack + haySize) that are in the char class
+*/
+inline size_t countCharClass(const char* const hayStack, const size_t haySize, const uint8_t* const table) noexcept
+{
+    size_t matches = 0;
+    if (haySize < width)
+    {
+        for (const char* position = hayStack; position != hayStack + haySize; ++position)
+        {
+            matches += inCharClass(table, *position);
+        }
+        return matches;
+    }
+
+    const ClassTables tables = loadClassTables(table);
+    const char* position = hayStack;
+    for (; static_cast<size_t>(hayStack + haySize - position) >= width; position += width)
+    {
+        matches += popCount(classMask(load(position), tables));
+    }
+    const size_t remaining = static_cast<size_t>(hayStack + haySize - position);
+    if (remaining != 0)
+    {
+        matches += popCount(static_cast<Mask>(classMask(load(hayStack + haySize - width), tables) >> (width - remaining)));
+    }
+    return matches;
+}
+
+
+/**
+* Bit i of the result is set if block[i] is in the char class, a block is 64 chars whatever the vector width
+*/
+inline uint64_t classBlockMask(const char* const block, const ClassTables& tables) noexcept
+{
+    uint64_t mask = 0;
+    for (size_t i = 0; i < 64; i += width)
+    {
+        mask |= static_cast<uint64_t>(classMask(load(block + i), tables)) << i;
+    }
+    return mask;
+}
+
+
+/**
+* Calls visitor(index) for every char in [hayStack, hayStack + haySize) that is in the char class (not in it if negate is set),
+* in order, until it returns false. Works on 64 char blocks like forEachChar.
+*/
+template<bool negate, class Visitor>
+inline void forEachCharClass(const char* const hayStack, const size_t haySize, const uint8_t* const table, Visitor& visitor)
+{
+    if (haySize < 64)
+    {
+        for (size_t index = 0; index < haySize; ++index)
+        {
+            if (inCharClass(table, hayStack[index]) != negate && !visitor(index))
+            {
+                return;
+            }
+        }
+        return;
+    }
+
+    const ClassTables tables = loadClassTables(table);
+    const uint64_t flip = negate ? ~uint64_t(0) : 0;
+    size_t offset = 0;
+    for (; haySize - offset >= 64; offset += 64)
+    {
+        for (uint64_t mask = classBlockMask(hayStack + offset, tables) ^ flip; mask != 0; mask = clearLowestBit(mask))
+        {
+            if (!visitor(offset + trailingZeros(mask)))
+            {
+                return;
+            }
+        }
+    }
+    const size_t remaining = haySize - offset;
+    if (remaining != 0)
+    {
+        for (uint64_t mask = (classBlockMask(hayStack + haySize - 64, tables) ^ flip) >> (64 - remaining); mask != 0; mask = clearLowestBit(mask))
+        {
+            if (!visitor(offset + trailingZeros(mask)))
+            {
+                return;
+            }
+        }
+    }
+}
+#endif